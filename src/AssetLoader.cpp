@@ -0,0 +1,95 @@
+#include "AssetLoader.h"
+#include "EmbeddedSounds.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct AssetLoader
+{
+    const char* fileNames[ASSET_LOADER_CAPACITY];
+    Wave waves[ASSET_LOADER_CAPACITY];
+    bool ready[ASSET_LOADER_CAPACITY];
+    bool taken[ASSET_LOADER_CAPACITY];
+    double readyMs[ASSET_LOADER_CAPACITY];
+    int count;
+
+    std::chrono::steady_clock::time_point start;
+    mutable std::mutex mutex;
+    std::condition_variable decoded;
+    std::thread worker;
+};
+
+//----------------------------------------------------------------------------------
+// Worker
+//----------------------------------------------------------------------------------
+
+static void LoadAssets(AssetLoader* loader)
+{
+    for (int i = 0; i < loader->count; i++)
+    {
+        const EmbeddedSound* embedded = FindEmbeddedSound(loader->fileNames[i]);
+        Wave wave = (embedded != nullptr) ? LoadEmbeddedWave(*embedded) : LoadWave(loader->fileNames[i]);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loader->start).count();
+
+        {
+            std::lock_guard<std::mutex> lock(loader->mutex);
+            loader->waves[i] = wave;
+            loader->readyMs[i] = ms;
+            loader->ready[i] = true;
+        }
+        loader->decoded.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+AssetLoader* StartAssetLoader(const char* const* fileNames, int count)
+{
+    AssetLoader* loader = new AssetLoader();
+    loader->count = (count < ASSET_LOADER_CAPACITY) ? count : ASSET_LOADER_CAPACITY;
+    for (int i = 0; i < loader->count; i++) loader->fileNames[i] = fileNames[i];
+    loader->start = std::chrono::steady_clock::now();
+    loader->worker = std::thread(LoadAssets, loader);
+
+    return loader;
+}
+
+bool WaveReady(const AssetLoader* loader, int index)
+{
+    std::lock_guard<std::mutex> lock(loader->mutex);
+
+    return loader->ready[index];
+}
+
+Wave TakeWave(AssetLoader* loader, int index)
+{
+    std::unique_lock<std::mutex> lock(loader->mutex);
+    loader->decoded.wait(lock, [loader, index] { return loader->ready[index]; });
+    loader->taken[index] = true;
+
+    return loader->waves[index];
+}
+
+double WaveReadyMs(const AssetLoader* loader, int index)
+{
+    std::lock_guard<std::mutex> lock(loader->mutex);
+
+    return loader->ready[index] ? loader->readyMs[index] : 0.0;
+}
+
+void StopAssetLoader(AssetLoader* loader)
+{
+    if (loader == nullptr) return;
+
+    loader->worker.join();
+    for (int i = 0; i < loader->count; i++)
+        if (!loader->taken[i]) UnloadWave(loader->waves[i]);
+
+    delete loader;
+}
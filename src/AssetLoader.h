@@ -0,0 +1,25 @@
+#pragma once
+#include "raylib.h"
+
+// Sound files read and decoded on a worker thread while the main thread brings up the
+// window and audio device. The worker loads the files in order; the main thread turns each
+// finished Wave into a Sound (that needs the audio device) whenever it likes: WaveReady
+// checks without blocking, TakeWave waits for that one file only. Sounds compiled into the
+// executable (EmbeddedSounds.h) are taken from there instead of the file.
+// NOTE: Every wave should be taken (and unloaded by the caller) before StopAssetLoader.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int ASSET_LOADER_CAPACITY = 8;
+
+typedef struct AssetLoader AssetLoader;     // Owns the worker thread
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+AssetLoader* StartAssetLoader(const char* const* fileNames, int count);    // Names must outlive the loader
+bool WaveReady(const AssetLoader* loader, int index);
+Wave TakeWave(AssetLoader* loader, int index);          // Waits until decoded, empty wave if the file failed
+double WaveReadyMs(const AssetLoader* loader, int index);   // Since StartAssetLoader, when decoding finished
+void StopAssetLoader(AssetLoader* loader);              // Waits for the worker, frees untaken waves
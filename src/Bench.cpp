@@ -0,0 +1,801 @@
+#include "Bench.h"
+#include "raylib.h"     // Before Math.h, which skips the types raylib declares
+#include "Compact.h"
+#include "EmbeddedSounds.h"
+#include "HudText.h"
+#include "MappedWave.h"
+#include "Particles.h"
+#include "RectBatch.h"
+#include "Fixed.h"
+#include "Serve.h"
+#include "VectorExpr.h"
+#include "VoicePool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+typedef std::chrono::high_resolution_clock BenchClock;
+
+// Milliseconds elapsed since start
+static double ElapsedMs(BenchClock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+//----------------------------------------------------------------------------------
+// Fixed-point vs float ball integration
+//----------------------------------------------------------------------------------
+static void BenchFixed()
+{
+    const int count = 100000;
+    const int steps = 600;
+    const float width = 1200.0f;
+    const float height = 800.0f;
+    const float delta = 600.0f / 60.0f;
+
+    // Fixed state is seeded from integers only (hashed counter, raw positions, binary angles),
+    // the float state is converted from it so both integrate the same balls
+    std::vector<Vector2> position(count), direction(count);
+    std::vector<FixedVector2> fixedPosition(count), fixedDirection(count);
+    ServeRandom random = SeedServe(1);
+    for (int i = 0; i < count; i++)
+    {
+        fixedPosition[i].x.raw = (int32_t)(ServeHash(random.counter++) % ((uint32_t)width * FIXED_ONE));
+        fixedPosition[i].y.raw = (int32_t)(ServeHash(random.counter++) % ((uint32_t)height * FIXED_ONE));
+        fixedDirection[i] = Direction((FixedAngle)(ServeHash(random.counter++) >> 16));
+        position[i] = { ToFloat(fixedPosition[i].x), ToFloat(fixedPosition[i].y) };
+        direction[i] = { ToFloat(fixedDirection[i].x), ToFloat(fixedDirection[i].y) };
+    }
+
+    BenchClock::time_point start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            Vector2 p = position[i] + direction[i] * delta;
+            if (p.x < 0.0f || p.x > width) direction[i].x *= -1.0f;
+            if (p.y < 0.0f || p.y > height) direction[i].y *= -1.0f;
+            position[i] = Clamp(p, Vector2{ 0.0f, 0.0f }, Vector2{ width, height });
+        }
+    }
+    double floatMs = ElapsedMs(start);
+
+    Fixed fixedDelta = ToFixed((int)delta);
+    FixedVector2 fixedMin = { ToFixed(0), ToFixed(0) };
+    FixedVector2 fixedMax = { ToFixed((int)width), ToFixed((int)height) };
+    start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            FixedVector2 p = fixedPosition[i] + fixedDirection[i] * fixedDelta;
+            if (p.x.raw < fixedMin.x.raw || p.x.raw > fixedMax.x.raw) fixedDirection[i].x = Negate(fixedDirection[i].x);
+            if (p.y.raw < fixedMin.y.raw || p.y.raw > fixedMax.y.raw) fixedDirection[i].y = Negate(fixedDirection[i].y);
+            fixedPosition[i] = Clamp(p, fixedMin, fixedMax);
+        }
+    }
+    double fixedMs = ElapsedMs(start);
+
+    // Checksum of the fixed state only, integer from seed to end so it matches on every machine and compiler
+    uint32_t checksum = 2166136261u;
+    for (int i = 0; i < count; i++)
+    {
+        checksum = (checksum ^ (uint32_t)fixedPosition[i].x.raw) * 16777619u;
+        checksum = (checksum ^ (uint32_t)fixedPosition[i].y.raw) * 16777619u;
+    }
+
+    printf("fixed: integrate %d balls x %d steps\n", count, steps);
+    printf("  float  %8.2f ms\n", floatMs);
+    printf("  fixed  %8.2f ms (%.2fx float), state checksum %08x\n", fixedMs, fixedMs / floatMs, checksum);
+
+    // Rotate and normalize throughput
+    std::vector<Vector2> v(count);
+    std::vector<FixedVector2> fv(count);
+    for (int i = 0; i < count; i++) v[i] = direction[i] * 3.0f, fv[i] = fixedDirection[i] * ToFixed(3);
+
+    start = BenchClock::now();
+    for (int s = 0; s < 100; s++)
+        for (int i = 0; i < count; i++) v[i] = Normalize(Rotate(v[i], 0.01f)) * 3.0f;
+    floatMs = ElapsedMs(start);
+
+    start = BenchClock::now();
+    FixedAngle step = ToFixedAngle(0.01f);
+    for (int s = 0; s < 100; s++)
+        for (int i = 0; i < count; i++) fv[i] = Normalize(Rotate(fv[i], step)) * ToFixed(3);
+    fixedMs = ElapsedMs(start);
+
+    printf("fixed: rotate + normalize %d vectors x 100\n", count);
+    printf("  float  %8.2f ms (sink %f)\n", floatMs, v[count / 2].x);
+    printf("  fixed  %8.2f ms (%.2fx float, sink %f)\n", fixedMs, fixedMs / floatMs, ToFloat(fv[count / 2].x));
+}
+
+//----------------------------------------------------------------------------------
+// Operator chains vs fused lazy expressions over arrays
+//----------------------------------------------------------------------------------
+static void BenchExpr()
+{
+    const int count = 1000000;
+    const int steps = 100;
+    const float dt = 1.0f / 60.0f;
+
+    std::vector<Vector2> position(count), velocity(count), acceleration(count);
+    std::vector<float> speed(count);
+    srand(1);
+    for (int i = 0; i < count; i++)
+    {
+        position[i] = { Random(0.0f, 1200.0f), Random(0.0f, 800.0f) };
+        velocity[i] = { Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) };
+        acceleration[i] = { 0.0f, Random(0.0f, 9.8f) };
+        speed[i] = Random(300.0f, 600.0f);
+    }
+    std::vector<Vector2> lazyPosition = position;
+
+    // pos += vel * speed * dt + acc * (0.5 * dt^2)
+    BenchClock::time_point start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+        for (int i = 0; i < count; i++)
+            position[i] = position[i] + velocity[i] * (speed[i] * dt) + acceleration[i] * (0.5f * dt * dt);
+    double eagerMs = ElapsedMs(start);
+
+    Vector2* p = lazyPosition.data();
+    start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+        Assign(p, count, Lazy(p) + Lazy(velocity.data()) * Lazy(speed.data()) * dt + Lazy(acceleration.data()) * (0.5f * dt * dt));
+    double lazyMs = ElapsedMs(start);
+
+    printf("expr: integrate %d Vector2 x %d steps\n", count, steps);
+    printf("  operators  %8.2f ms\n", eagerMs);
+    printf("  fused      %8.2f ms (%.2fx operators, max diff %g)\n", lazyMs, lazyMs / eagerMs,
+        fmaxf(fabsf(position[count / 2].x - p[count / 2].x), fabsf(position[count / 2].y - p[count / 2].y)));
+
+    // Same step on Vector3
+    std::vector<Vector3> position3(count), velocity3(count);
+    for (int i = 0; i < count; i++) position3[i] = ToV3(position[i]), velocity3[i] = ToV3(velocity[i]);
+    std::vector<Vector3> lazyPosition3 = position3;
+
+    start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+        for (int i = 0; i < count; i++)
+            position3[i] = position3[i] + velocity3[i] * (speed[i] * dt) - position3[i] * 0.001f;
+    eagerMs = ElapsedMs(start);
+
+    Vector3* p3 = lazyPosition3.data();
+    start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+        Assign(p3, count, Lazy(p3) + Lazy(velocity3.data()) * Lazy(speed.data()) * dt - Lazy(p3) * 0.001f);
+    lazyMs = ElapsedMs(start);
+
+    printf("expr: integrate %d Vector3 x %d steps\n", count, steps);
+    printf("  operators  %8.2f ms\n", eagerMs);
+    printf("  fused      %8.2f ms (%.2fx operators)\n", lazyMs, lazyMs / eagerMs);
+}
+
+//----------------------------------------------------------------------------------
+// Float vs compact (quantized position + half direction) ball state
+//----------------------------------------------------------------------------------
+static void BenchCompact()
+{
+    const int count = 1 << 20;
+    const int steps = 50;
+    const int block = 1024;     // Unpacked working set per block stays in L1
+    const Vector2 arena = { 1200.0f, 800.0f };
+    const float delta = 600.0f / 60.0f;
+
+    std::vector<Vector2> position(count), direction(count);
+    srand(1);
+    for (int i = 0; i < count; i++)
+    {
+        position[i] = { Random(0.0f, arena.x), Random(0.0f, arena.y) };
+        direction[i] = Rotate(Vector2{ 1.0f, 0.0f }, Random(0.0f, 2.0f * PI));
+    }
+
+    std::vector<QuantizedVector2> packedPosition(count);
+    std::vector<HalfVector2> packedDirection(count);
+    Quantize(position.data(), packedPosition.data(), count, arena);
+    PackHalf(direction.data(), packedDirection.data(), count);
+
+    // Integrate and bounce one block in place
+    auto step = [&](Vector2* p, Vector2* d, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            Vector2 next = p[i] + d[i] * delta;
+            if (next.x < 0.0f || next.x > arena.x) d[i].x = -d[i].x;
+            if (next.y < 0.0f || next.y > arena.y) d[i].y = -d[i].y;
+            p[i] = Clamp(next, Vector2{ 0.0f, 0.0f }, arena);
+        }
+    };
+
+    BenchClock::time_point start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+        for (int i = 0; i < count; i += block) step(&position[i], &direction[i], block);
+    double floatMs = ElapsedMs(start);
+
+    std::vector<Vector2> p(block), d(block);
+    start = BenchClock::now();
+    for (int s = 0; s < steps; s++)
+    {
+        for (int i = 0; i < count; i += block)
+        {
+            Dequantize(&packedPosition[i], p.data(), block, arena);
+            UnpackHalf(&packedDirection[i], d.data(), block);
+            step(p.data(), d.data(), block);
+            Quantize(p.data(), &packedPosition[i], block, arena);
+            PackHalf(d.data(), &packedDirection[i], block);
+        }
+    }
+    double compactMs = ElapsedMs(start);
+
+    double floatBytes = (double)count * (sizeof(Vector2) * 2);
+    double compactBytes = (double)count * (sizeof(QuantizedVector2) + sizeof(HalfVector2));
+    printf("compact: batch sim, %d balls x %d steps\n", count, steps);
+    printf("  float    %6.1f MB state, %8.2f ms (%.2f GB/s read+write)\n", floatBytes / 1e6, floatMs, 2.0 * floatBytes * steps / (floatMs * 1e6));
+    printf("  compact  %6.1f MB state, %8.2f ms (%.2f GB/s read+write)\n", compactBytes / 1e6, compactMs, 2.0 * compactBytes * steps / (compactMs * 1e6));
+
+    // Replay keyframes: ball position and direction plus both paddle heights, every frame
+    const int frames = 60 * 60 * 10;
+    std::vector<Vector2> ball(frames), ballDirection(frames), paddles(frames);
+    for (int f = 0; f < frames; f++)
+    {
+        ball[f] = position[f];
+        ballDirection[f] = direction[f];
+        paddles[f] = { Random(40.0f, 760.0f), Random(40.0f, 760.0f) };
+    }
+
+    std::vector<QuantizedVector2> packedBall(frames), packedPaddles(frames);
+    std::vector<HalfVector2> packedBallDirection(frames);
+    Quantize(ball.data(), packedBall.data(), frames, arena);
+    Quantize(paddles.data(), packedPaddles.data(), frames, Vector2{ arena.y, arena.y });
+    PackHalf(ballDirection.data(), packedBallDirection.data(), frames);
+
+    float maxPositionError = 0.0f;
+    float maxDirectionError = 0.0f;
+    for (int f = 0; f < frames; f++)
+    {
+        Vector2 b = Dequantize(packedBall[f], arena);
+        Vector2 dir = ToVector2(packedBallDirection[f]);
+        maxPositionError = fmaxf(maxPositionError, fmaxf(fabsf(b.x - ball[f].x), fabsf(b.y - ball[f].y)));
+        maxDirectionError = fmaxf(maxDirectionError, fmaxf(fabsf(dir.x - ballDirection[f].x), fabsf(dir.y - ballDirection[f].y)));
+    }
+
+    size_t floatFrame = sizeof(Vector2) * 3;
+    size_t compactFrame = sizeof(QuantizedVector2) * 2 + sizeof(HalfVector2);
+    printf("compact: replay, 10 minute match at 60 FPS (%d keyframes)\n", frames);
+    printf("  float    %2d B/frame, %8.1f KB\n", (int)floatFrame, floatFrame * frames / 1024.0);
+    printf("  compact  %2d B/frame, %8.1f KB (max error %.4f px, direction %.5f)\n", (int)compactFrame,
+        compactFrame * frames / 1024.0, maxPositionError, maxDirectionError);
+}
+
+//----------------------------------------------------------------------------------
+// Serve directions: rand() + Rotate vs seeded table
+//----------------------------------------------------------------------------------
+static void BenchServe()
+{
+    const int count = 1 << 22;
+    const Vector2 center = { 600.0f, 400.0f };
+
+    std::vector<Vector2> position(count), direction(count);
+    srand(1);
+    BenchClock::time_point start = BenchClock::now();
+    for (int i = 0; i < count; i++)
+    {
+        // Same steps as the original ResetBall
+        position[i] = center;
+        direction[i].x = rand() % 2 == 0 ? -1.0f : 1.0f;
+        direction[i].y = 0.0f;
+        direction[i] = Rotate(direction[i], Random(0.0f, 60.0f) * DEG2RAD);
+    }
+    double rotateMs = ElapsedMs(start);
+
+    ServeRandom random = SeedServe(1);
+    start = BenchClock::now();
+    for (int i = 0; i < count; i++)
+    {
+        position[i] = center;
+        direction[i] = ServeDirection(random);
+    }
+    double singleMs = ElapsedMs(start);
+
+    random = SeedServe(1);
+    start = BenchClock::now();
+    ServeBalls(random, position.data(), direction.data(), count, center);
+    double bulkMs = ElapsedMs(start);
+
+    // Unit length, both sides equally often, angle inside [0, 60] degrees from the serve side
+    float maxLengthError = 0.0f;
+    int left = 0;
+    int outOfRange = 0;
+    for (int i = 0; i < count; i++)
+    {
+        float side = direction[i].x < 0.0f ? -1.0f : 1.0f;
+        float angle = atan2f(side * direction[i].y, side * direction[i].x);
+        maxLengthError = fmaxf(maxLengthError, fabsf(Length(direction[i]) - 1.0f));
+        if (side < 0.0f) left++;
+        if (angle < 0.0f || angle > 60.0f * DEG2RAD + 1e-6f) outOfRange++;
+    }
+
+    printf("serve: %d serves\n", count);
+    printf("  rand + Rotate  %8.2f ms\n", rotateMs);
+    printf("  ServeDirection %8.2f ms (%.1fx faster)\n", singleMs, rotateMs / singleMs);
+    printf("  ServeBalls     %8.2f ms (%.1fx faster)\n", bulkMs, rotateMs / bulkMs);
+    printf("  max length error %.2e, left serves %.3f%%, out of range %d\n", maxLengthError, 100.0 * left / count, outOfRange);
+}
+
+//----------------------------------------------------------------------------------
+// Scene matrices: Scale * Rotate * Translate vs TRS vs cached TRS
+//----------------------------------------------------------------------------------
+static void BenchTransform()
+{
+    const int count = 100000;
+    const int frames = 200;
+    const int moving = count / 100;     // Objects changed per frame
+
+    std::vector<Transform> transform(count);
+    std::vector<CachedTransform> cached(count);
+    std::vector<Matrix> matrix(count);
+    srand(1);
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 axis = Normalize(Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(0.1f, 1.0f) });
+        float scale = Random(0.5f, 2.0f);
+        transform[i].translation = { Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+        transform[i].rotation = FromAxisAngle(axis, Random(0.0f, 2.0f * PI));
+        transform[i].scale = { scale, scale, scale };
+        cached[i] = ToCached(transform[i]);
+    }
+
+    // Spin a few objects each frame, then get every object's matrix
+    Quaternion spin = FromAxisAngle(Vector3{ 0.0f, 1.0f, 0.0f }, 0.01f);
+    float checksum = 0.0f;
+
+    BenchClock::time_point start = BenchClock::now();
+    for (int f = 0; f < frames; f++)
+    {
+        for (int i = f * moving % count, n = 0; n < moving; n++, i = (i + 1) % count)
+            transform[i].rotation = Multiply(spin, transform[i].rotation);
+        for (int i = 0; i < count; i++)
+        {
+            const Transform& t = transform[i];
+            matrix[i] = Multiply(Multiply(Scale(t.scale.x, t.scale.y, t.scale.z), ToMatrix(t.rotation)),
+                Translate(t.translation.x, t.translation.y, t.translation.z));
+        }
+        checksum += matrix[f].m12;
+    }
+    double matrixMs = ElapsedMs(start);
+
+    start = BenchClock::now();
+    for (int f = 0; f < frames; f++)
+    {
+        for (int i = f * moving % count, n = 0; n < moving; n++, i = (i + 1) % count)
+            transform[i].rotation = Multiply(spin, transform[i].rotation);
+        for (int i = 0; i < count; i++) matrix[i] = ToMatrix(transform[i]);
+        checksum += matrix[f].m12;
+    }
+    double trsMs = ElapsedMs(start);
+
+    start = BenchClock::now();
+    for (int f = 0; f < frames; f++)
+    {
+        for (int i = f * moving % count, n = 0; n < moving; n++, i = (i + 1) % count)
+            SetRotation(cached[i], Multiply(spin, cached[i].transform.rotation));
+        for (int i = 0; i < count; i++) checksum += GetMatrix(cached[i]).m0 * 0.0f;
+    }
+    double cachedMs = ElapsedMs(start);
+
+    // Accuracy of the TRS operations against the matrix path
+    float maxError = 0.0f;
+    for (int i = 0; i + 1 < count; i += 97)
+    {
+        const Transform& a = transform[i];
+        const Transform& b = transform[i + 1];
+        Matrix ma = Multiply(Multiply(Scale(a.scale.x, a.scale.y, a.scale.z), ToMatrix(a.rotation)), Translate(a.translation.x, a.translation.y, a.translation.z));
+        Matrix mb = Multiply(Multiply(Scale(b.scale.x, b.scale.y, b.scale.z), ToMatrix(b.rotation)), Translate(b.translation.x, b.translation.y, b.translation.z));
+        Matrix combined = ToMatrix(Multiply(a, b));
+        Matrix inverse = ToMatrix(Invert(a));
+        Matrix expected = Multiply(ma, mb);
+        Matrix expectedInverse = Invert(ma);
+        const float* m1 = &combined.m0;
+        const float* m2 = &expected.m0;
+        const float* m3 = &inverse.m0;
+        const float* m4 = &expectedInverse.m0;
+        for (int k = 0; k < 16; k++) maxError = fmaxf(maxError, fmaxf(fabsf(m1[k] - m2[k]), fabsf(m3[k] - m4[k])));
+    }
+
+    printf("transform: %d objects x %d frames, %d moving per frame\n", count, frames, moving);
+    printf("  Scale * Rotate * Translate  %8.2f ms (%d B/object)\n", matrixMs, (int)sizeof(Matrix));
+    printf("  ToMatrix(Transform)         %8.2f ms (%d B/object)\n", trsMs, (int)sizeof(Transform));
+    printf("  CachedTransform             %8.2f ms (%d B/object)\n", cachedMs, (int)sizeof(CachedTransform));
+    printf("  compose/invert max error vs Matrix %.2e (checksum %.1f)\n", maxError, checksum);
+}
+
+//----------------------------------------------------------------------------------
+// HUD text: TextFormat + DrawText every frame vs cached HudText (opens a hidden window)
+//----------------------------------------------------------------------------------
+static void BenchHud()
+{
+    const int frames = 3000;
+    const int scoreFrames = 600;    // Frames between score changes
+    const int volleyFrames = 120;   // Frames between volleys
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(1200, 800, "HUD bench");
+
+    double drawTextMs = 0.0;
+    int glyphQuads = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        BeginDrawing();
+        ClearBackground(BLACK);
+        BenchClock::time_point start = BenchClock::now();
+        const char* score1 = TextFormat("Player One: %i", f / scoreFrames);
+        DrawText(score1, 20, 10, 20, GRAY);
+        const char* score2 = TextFormat("Player Two: %i", f / (2 * scoreFrames));
+        DrawText(score2, 1050, 10, 20, GRAY);
+        const char* volley = TextFormat("%i Volleys!", f / volleyFrames);
+        DrawText(volley, 500, 200, 50, SKYBLUE);
+        drawTextMs += ElapsedMs(start);
+        glyphQuads = (int)(strlen(score1) + strlen(score2) + strlen(volley));
+        EndDrawing();
+    }
+
+    HudText player1Text = LoadHudText("Player One: %i", 20, GRAY);
+    HudText player2Text = LoadHudText("Player Two: %i", 20, GRAY);
+    HudText volleyText = LoadHudText("%i Volleys!", 50, SKYBLUE);
+    double cachedMs = 0.0;
+    for (int f = 0; f < frames; f++)
+    {
+        BenchClock::time_point start = BenchClock::now();
+        UpdateHudText(player1Text, f / scoreFrames);
+        UpdateHudText(player2Text, f / (2 * scoreFrames));
+        UpdateHudText(volleyText, f / volleyFrames);
+        cachedMs += ElapsedMs(start);
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+        start = BenchClock::now();
+        DrawHudText(player1Text, 20, 10);
+        DrawHudText(player2Text, 1050, 10);
+        DrawHudText(volleyText, 500, 200);
+        cachedMs += ElapsedMs(start);
+        EndDrawing();
+    }
+    UnloadHudText(player1Text);
+    UnloadHudText(player2Text);
+    UnloadHudText(volleyText);
+    CloseWindow();
+
+    printf("hud: 3 labels x %d frames (CPU time of HUD calls)\n", frames);
+    printf("  TextFormat + DrawText  %8.4f ms/frame, up to %d glyph quads\n", drawTextMs / frames, glyphQuads);
+    printf("  HudText                %8.4f ms/frame, 3 quads\n", cachedMs / frames);
+}
+
+//----------------------------------------------------------------------------------
+// Rectangles: DrawRectangleRec each vs RectBatch (opens a hidden window)
+//----------------------------------------------------------------------------------
+static void BenchRects()
+{
+    const int sizes[] = { 10, 1000, 100000 };
+    const int frames = 200;
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(1200, 800, "Rectangle bench");
+
+    std::vector<Rectangle> rects(100000);
+    std::vector<Color> colors(rects.size());
+    srand(1);
+    for (size_t i = 0; i < rects.size(); i++)
+    {
+        rects[i] = { Random(0.0f, 1160.0f), Random(0.0f, 760.0f), 40.0f, Random(10.0f, 80.0f) };
+        colors[i] = { (unsigned char)(rand() & 255), (unsigned char)(rand() & 255), (unsigned char)(rand() & 255), 255 };
+    }
+
+    RectBatch batch = LoadRectBatch(16384);
+    printf("rects: %d frames per size (frame time incl. EndDrawing)\n", frames);
+    for (int count : sizes)
+    {
+        BenchClock::time_point start = BenchClock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            for (int i = 0; i < count; i++) DrawRectangleRec(rects[i], colors[i]);
+            EndDrawing();
+        }
+        double drawMs = ElapsedMs(start) / frames;
+
+        start = BenchClock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            for (int i = 0; i < count; i++) AddRect(batch, rects[i], colors[i]);
+            DrawRectBatch(batch);
+            EndDrawing();
+        }
+        double batchMs = ElapsedMs(start) / frames;
+
+        printf("  %6d  DrawRectangleRec %8.3f ms, RectBatch %8.3f ms (%d draws)\n", count, drawMs, batchMs,
+            (count + batch.capacity - 1) / batch.capacity);
+    }
+
+    UnloadRectBatch(batch);
+    CloseWindow();
+}
+
+//----------------------------------------------------------------------------------
+// Particles: new/delete per particle vs SoA pool (opens a hidden window)
+//----------------------------------------------------------------------------------
+static void BenchParticles()
+{
+    const int count = 100000;
+    const int frames = 300;
+    const int burst = 256;
+    const float dt = 1.0f / 60.0f;
+
+    // Bursts at random spots until the pool is full again; lives of 1-2 s turn over ~1/90 per frame
+    auto refill = [&](ParticlePool& pool)
+    {
+        while (pool.count < pool.capacity)
+        {
+            ParticleBurst b = { burst, { Random(0.0f, 1200.0f), Random(0.0f, 800.0f) }, {}, 20.0f, 200.0f, 1.0f, 2.0f, 4.0f, SKYBLUE };
+            EmitParticles(pool, b);
+        }
+    };
+
+    // Naive version: one heap object per particle, freed when it dies
+    struct NaiveParticle
+    {
+        Vector2 position;
+        Vector2 velocity;
+        float life;
+        float fade;
+        float size;
+        Color color;
+    };
+
+    std::vector<NaiveParticle*> naive;
+    naive.reserve(count);
+    srand(1);
+    double naiveMs = 0.0;
+    for (int f = 0; f < frames; f++)
+    {
+        BenchClock::time_point start = BenchClock::now();
+        float keep = powf(0.1f, dt);
+        for (size_t i = 0; i < naive.size(); )
+        {
+            NaiveParticle* p = naive[i];
+            p->velocity = p->velocity * keep;
+            p->position = p->position + p->velocity * dt;
+            p->life -= dt;
+            if (p->life > 0.0f)
+            {
+                i++;
+                continue;
+            }
+            delete p;
+            naive[i] = naive.back();
+            naive.pop_back();
+        }
+        while ((int)naive.size() < count)
+        {
+            Vector2 position = { Random(0.0f, 1200.0f), Random(0.0f, 800.0f) };
+            for (int i = 0; i < burst && (int)naive.size() < count; i++)
+            {
+                NaiveParticle* p = new NaiveParticle();
+                float angle = Random(0.0f, 2.0f * PI);
+                float speed = Random(20.0f, 200.0f);
+                p->position = position;
+                p->velocity = { cosf(angle) * speed, sinf(angle) * speed };
+                p->life = Random(1.0f, 2.0f);
+                p->fade = 1.0f / p->life;
+                p->size = 4.0f;
+                p->color = SKYBLUE;
+                naive.push_back(p);
+            }
+        }
+        naiveMs += ElapsedMs(start);
+    }
+    for (NaiveParticle* p : naive) delete p;
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(1200, 800, "Particle bench");
+
+    ParticlePool pool = LoadParticlePool(count, 0.1f, 1);
+    RectBatch batch = LoadRectBatch(count);
+    SoftCanvas canvas = LoadSoftCanvas(1200, 800);
+    refill(pool);
+
+    double updateMs = 0.0;
+    double emitMs = 0.0;
+    double batchMs = 0.0;
+    double softMs = 0.0;
+    long long live = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        BenchClock::time_point start = BenchClock::now();
+        UpdateParticles(pool, dt);
+        updateMs += ElapsedMs(start);
+        live += pool.count;
+
+        start = BenchClock::now();
+        refill(pool);
+        emitMs += ElapsedMs(start);
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+        start = BenchClock::now();
+        AddParticles(batch, pool);
+        DrawRectBatch(batch);
+        batchMs += ElapsedMs(start);
+        EndDrawing();
+
+        start = BenchClock::now();
+        SoftClearBackground(canvas, BLACK);
+        DrawParticles(canvas, pool);
+        softMs += ElapsedMs(start);
+    }
+
+    printf("particles: %d live x %d frames, %.0f die per frame\n", count, frames, count - (double)live / frames);
+    printf("  new/delete each      %8.3f ms/frame update + emit\n", naiveMs / frames);
+    printf("  pool                 %8.3f ms/frame update + emit (%.3f + %.3f)\n", (updateMs + emitMs) / frames, updateMs / frames, emitMs / frames);
+    printf("  RectBatch            %8.3f ms/frame fill + draw (1 draw)\n", batchMs / frames);
+    printf("  software             %8.3f ms/frame clear + draw\n", softMs / frames);
+
+    UnloadSoftCanvas(canvas);
+    UnloadRectBatch(batch);
+    UnloadParticlePool(pool);
+    CloseWindow();
+}
+
+//----------------------------------------------------------------------------------
+// Sound loading: file vs embedded file vs embedded samples
+//----------------------------------------------------------------------------------
+static void BenchSounds()
+{
+    const char* const files[] = { "ping_pong_8bit_beeep.wav", "ping_pong_8bit_peeeeeep.wav", "ping_pong_8bit_plop.wav" };
+    const int rounds = 200;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Every load of all three files, as the game does at startup
+    auto measure = [&](Wave (*load)(const char* fileName)) -> double
+    {
+        BenchClock::time_point start = BenchClock::now();
+        for (int r = 0; r < rounds; r++)
+        {
+            for (const char* file : files)
+            {
+                Wave wave = load(file);
+                UnloadWave(wave);
+            }
+        }
+        return ElapsedMs(start) / rounds;
+    };
+
+    double fileMs = measure([](const char* fileName) { return LoadWave(fileName); });
+    printf("sounds: %d files x %d rounds, %d embedded\n", (int)(sizeof(files) / sizeof(files[0])), rounds, GetEmbeddedSoundCount());
+    printf("  LoadWave (file)      %8.3f ms per startup\n", fileMs);
+    if (GetEmbeddedSoundCount() == 0)
+    {
+        printf("  not built with EMBED_SOUNDS, nothing embedded to compare\n");
+        return;
+    }
+
+    double memoryMs = measure([](const char* fileName) { return LoadEmbeddedWaveFile(*FindEmbeddedSound(fileName)); });
+    double samplesMs = measure([](const char* fileName) { return LoadEmbeddedWave(*FindEmbeddedSound(fileName)); });
+    printf("  embedded file        %8.3f ms per startup (LoadWaveFromMemory)\n", memoryMs);
+    printf("  embedded samples     %8.3f ms per startup (copy only)\n", samplesMs);
+}
+
+//----------------------------------------------------------------------------------
+// Sounds for many matches: loaded per match vs one shared mapping
+//----------------------------------------------------------------------------------
+static void BenchWaveMapping()
+{
+    const char* const files[] = { "ping_pong_8bit_beeep.wav", "ping_pong_8bit_peeeeeep.wav", "ping_pong_8bit_plop.wav" };
+    const int fileCount = (int)(sizeof(files) / sizeof(files[0]));
+    const int matches = 64;
+
+    SetTraceLogLevel(LOG_WARNING);
+    InitAudioDevice();
+    if (!IsAudioDeviceReady())
+    {
+        printf("wavmap: no audio device, nothing to load sounds into\n");
+        return;
+    }
+
+    // Every match loads its own copy, as LoadSound does
+    std::vector<Sound> sounds;
+    size_t before = GetResidentMemory();
+    BenchClock::time_point start = BenchClock::now();
+    for (int m = 0; m < matches; m++)
+        for (const char* file : files) sounds.push_back(LoadSound(file));
+    double loadMs = ElapsedMs(start);
+    double loadedKb = ((double)GetResidentMemory() - before) / 1024.0;
+    for (Sound& sound : sounds) UnloadSound(sound);
+
+    // Every match maps the files (one mapping) and streams them, one voice per sound; every
+    // sample read once so the mapped pages count as resident, as they would after playing
+    std::vector<VoicePool> pools(matches);
+    std::vector<MappedWave> waves;
+    before = GetResidentMemory();
+    start = BenchClock::now();
+    for (int m = 0; m < matches; m++)
+    {
+        for (const char* file : files)
+        {
+            waves.push_back(MapWave(file));
+            AddVoiceStream(pools[m], waves.back(), 1, 1.0f);
+        }
+    }
+    double mapMs = ElapsedMs(start);
+    unsigned int sum = 0;
+    for (int i = 0; i < fileCount; i++)
+    {
+        const unsigned char* samples = (const unsigned char*)waves[i].data;
+        if (samples == nullptr) continue;
+        size_t size = (size_t)waves[i].frameCount * waves[i].channels * (waves[i].sampleSize / 8);
+        for (size_t b = 0; b < size; b += 512) sum += samples[b];
+    }
+    double mappedKb = ((double)GetResidentMemory() - before) / 1024.0;
+
+    printf("wavmap: %d matches x %d sounds (checksum %u)\n", matches, fileCount, sum);
+    printf("  LoadSound per match  %8.3f ms, %7.0f KB resident\n", loadMs, loadedKb);
+    printf("  mapped + streamed    %8.3f ms, %7.0f KB resident\n", mapMs, mappedKb);
+
+    for (VoicePool& pool : pools) UnloadVoicePool(pool);
+    for (MappedWave& wave : waves) UnmapWave(wave);
+    CloseAudioDevice();
+}
+
+//----------------------------------------------------------------------------------
+// Benchmark registry
+//----------------------------------------------------------------------------------
+void BenchMath();   // MathBench.cpp
+
+struct BenchEntry
+{
+    const char* name;
+    void (*run)();
+};
+
+static const BenchEntry BENCHES[] = {
+    { "fixed", BenchFixed },
+    { "expr", BenchExpr },
+    { "math", BenchMath },
+    { "compact", BenchCompact },
+    { "serve", BenchServe },
+    { "transform", BenchTransform },
+    { "hud", BenchHud },
+    { "rects", BenchRects },
+    { "particles", BenchParticles },
+    { "sounds", BenchSounds },
+    { "wavmap", BenchWaveMapping },
+};
+
+int RunBench(const char* name)
+{
+    bool found = false;
+    for (const BenchEntry& bench : BENCHES)
+    {
+        if (strcmp(name, "all") == 0 || strcmp(name, bench.name) == 0)
+        {
+            bench.run();
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        printf("Unknown benchmark \"%s\". Available: all", name);
+        for (const BenchEntry& bench : BENCHES) printf(", %s", bench.name);
+        printf("\n");
+        return 1;
+    }
+
+    return 0;
+}
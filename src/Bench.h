@@ -0,0 +1,5 @@
+#pragma once
+
+// Command line benchmarks, run with: raylib5-vs2022.exe --bench <name|all>
+// Each benchmark prints its timings to stdout. Returns non-zero for an unknown name.
+int RunBench(const char* name);
@@ -0,0 +1,322 @@
+#include "Capture.h"
+#include "ScreenReadback.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct CaptureBuffer
+{
+    std::vector<Color> pixels;
+    int frame;
+};
+
+struct FrameCapture
+{
+    std::string path;
+    std::string prefix;                     // PNG names: prefix, frame number padded to digits, suffix
+    std::string suffix;
+    int digits;
+    CaptureFormat format;
+    int width;
+    int height;
+    FILE* video;                            // Y4M stream
+
+    std::vector<CaptureBuffer> buffers;
+    std::deque<CaptureBuffer*> available;   // Ready to be filled by the main thread
+    std::deque<CaptureBuffer*> queued;      // Waiting for the encoder
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool stopping;
+    std::thread encoder;
+
+    // Stats, main thread only
+    int frames;
+    int dropped;
+    double captureMs;                       // Time spent inside CaptureFrame
+};
+
+//----------------------------------------------------------------------------------
+// Encoder
+//----------------------------------------------------------------------------------
+
+static void WriteY4MFrame(FILE* file, const CaptureBuffer& buffer, int width, int height, std::vector<unsigned char>& planes)
+{
+    planes.resize(Y4MFrameSize(width, height));
+    ConvertY4MFrame(buffer.pixels.data(), width, height, planes.data());
+
+    fputs("FRAME\n", file);
+    fwrite(planes.data(), 1, planes.size(), file);
+}
+
+static void EncodeFrames(FrameCapture* capture)
+{
+    std::vector<unsigned char> planes;
+
+    for (;;)
+    {
+        CaptureBuffer* buffer = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(capture->mutex);
+            capture->ready.wait(lock, [capture] { return !capture->queued.empty() || capture->stopping; });
+            if (capture->queued.empty()) return;    // Stopping and drained
+            buffer = capture->queued.front();
+            capture->queued.pop_front();
+        }
+
+        if (capture->format == CAPTURE_Y4M) WriteY4MFrame(capture->video, *buffer, capture->width, capture->height, planes);
+        else
+        {
+            for (Color& pixel : buffer->pixels) pixel.a = 255;    // Screen reads keep the framebuffer's alpha, PNG would show it
+            char fileName[512];
+            snprintf(fileName, sizeof(fileName), "%s%0*d%s", capture->prefix.c_str(), capture->digits, buffer->frame, capture->suffix.c_str());
+            Image image = { buffer->pixels.data(), capture->width, capture->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            ExportImage(image, fileName);
+        }
+
+        std::lock_guard<std::mutex> lock(capture->mutex);
+        capture->available.push_back(buffer);
+    }
+}
+
+// Split a PNG path around its frame number: one %d (%05d...) where it goes, or none for
+// "_00000" before the extension; false for any other % (never used as a printf format)
+static bool SplitFramePath(FrameCapture* capture, const char* path)
+{
+    std::string name = path;
+    size_t percent = name.find('%');
+    if (percent == std::string::npos)
+    {
+        size_t dot = name.find_last_of('.');
+        size_t slash = name.find_last_of("/\\");
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) dot = name.size();
+        capture->prefix = name.substr(0, dot) + "_";
+        capture->digits = 5;
+        capture->suffix = name.substr(dot);
+        return true;
+    }
+
+    size_t at = percent + 1;
+    int digits = 0;
+    while (at < name.size() && name[at] >= '0' && name[at] <= '9' && digits < 100) digits = digits * 10 + (name[at++] - '0');
+    if (at >= name.size() || name[at] != 'd' || name.find('%', at) != std::string::npos) return false;
+
+    capture->prefix = name.substr(0, percent);
+    capture->digits = (digits > 0) ? digits : 1;
+    capture->suffix = name.substr(at + 1);
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+FrameCapture* StartCapture(const char* path, CaptureFormat format, int width, int height, int fps, int bufferCount)
+{
+    FrameCapture* capture = new FrameCapture();
+    capture->path = path;
+    capture->format = format;
+    capture->width = width;
+    capture->height = height;
+    capture->video = nullptr;
+    capture->stopping = false;
+    capture->frames = 0;
+    capture->dropped = 0;
+    capture->captureMs = 0.0;
+
+    if (format == CAPTURE_PNG && !SplitFramePath(capture, path))
+    {
+        printf("capture: %s should have one %%d for the frame number (or none, for name_00000.png)\n", path);
+        delete capture;
+        return nullptr;
+    }
+
+    if (format == CAPTURE_Y4M)
+    {
+        capture->video = fopen(path, "wb");
+        if (capture->video == nullptr)
+        {
+            printf("capture: can't open %s\n", path);
+            delete capture;
+            return nullptr;
+        }
+        WriteY4MHeader(capture->video, width, height, fps);
+    }
+
+    // Allocated up front, the main thread never allocates while capturing
+    capture->buffers.resize(bufferCount);
+    for (CaptureBuffer& buffer : capture->buffers)
+    {
+        buffer.pixels.resize((size_t)width * height);
+        capture->available.push_back(&buffer);
+    }
+
+    capture->encoder = std::thread(EncodeFrames, capture);
+
+    return capture;
+}
+
+Color* AcquireCaptureFrame(FrameCapture* capture)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    capture->frames++;
+
+    CaptureBuffer* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(capture->mutex);
+        if (!capture->available.empty())
+        {
+            buffer = capture->available.front();
+            capture->available.pop_front();
+        }
+    }
+
+    if (buffer == nullptr) capture->dropped++;
+    else buffer->frame = capture->frames - 1;
+
+    capture->captureMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    return (buffer != nullptr) ? buffer->pixels.data() : nullptr;
+}
+
+void SubmitCaptureFrame(FrameCapture* capture, Color* pixels)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (CaptureBuffer& buffer : capture->buffers)
+    {
+        if (buffer.pixels.data() == pixels)
+        {
+            {
+                std::lock_guard<std::mutex> lock(capture->mutex);
+                capture->queued.push_back(&buffer);
+            }
+            capture->ready.notify_one();
+            break;
+        }
+    }
+
+    capture->captureMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool CaptureFrame(FrameCapture* capture, const Color* pixels)
+{
+    Color* buffer = AcquireCaptureFrame(capture);
+    if (buffer == nullptr) return false;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    memcpy(buffer, pixels, (size_t)capture->width * capture->height * sizeof(Color));
+    capture->captureMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    SubmitCaptureFrame(capture, buffer);
+
+    return true;
+}
+
+bool CaptureScreenReadback(FrameCapture* capture, ScreenReadback* readback, bool flush)
+{
+    bool captured = false;
+    do
+    {
+        Color* buffer = nullptr;
+        int queued = GetScreenReadbackQueued(readback);
+        bool due = flush ? queued > 0 : queued == SCREEN_READBACK_DEPTH;
+        if (due) buffer = AcquireCaptureFrame(capture);     // Counts the frame, or its drop
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (due) TakeScreenReadback(readback, buffer);      // A dropped frame is only released
+        if (!flush) QueueScreenReadback(readback);
+        capture->captureMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (buffer != nullptr) SubmitCaptureFrame(capture, buffer);
+        captured |= buffer != nullptr;
+    } while (flush && GetScreenReadbackQueued(readback) > 0);
+
+    return captured;
+}
+
+void SkipCaptureFrame(FrameCapture* capture)
+{
+    capture->frames++;
+    capture->dropped++;
+}
+
+void StopCapture(FrameCapture* capture)
+{
+    if (capture == nullptr) return;
+
+    {
+        std::lock_guard<std::mutex> lock(capture->mutex);
+        capture->stopping = true;
+    }
+    capture->ready.notify_one();
+    capture->encoder.join();
+
+    if (capture->video != nullptr) fclose(capture->video);
+
+    printf("capture: %d frames, %d dropped, %.3f ms per frame on the main thread\n", capture->frames, capture->dropped,
+        capture->captureMs / (capture->frames > 0 ? capture->frames : 1));
+
+    delete capture;
+}
+
+CaptureFormat GetCaptureFormat(const char* path)
+{
+    size_t length = strlen(path);
+
+    return (length >= 4 && strcmp(path + length - 4, ".y4m") == 0) ? CAPTURE_Y4M : CAPTURE_PNG;
+}
+
+int WriteY4MHeader(FILE* file, int width, int height, int fps)
+{
+    return fprintf(file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, fps);
+}
+
+size_t Y4MFrameSize(int width, int height)
+{
+    return (size_t)width * height + 2 * (size_t)(width / 2) * (height / 2);
+}
+
+// Saturate a chroma value, pure blue and red land just past 255
+static unsigned char ClampByte(int value)
+{
+    return (unsigned char)((value < 0) ? 0 : (value > 255) ? 255 : value);
+}
+
+// RGBA to planar 4:2:0, luma per pixel and chroma averaged over 2x2 blocks
+void ConvertY4MFrame(const Color* pixels, int width, int height, unsigned char* planes)
+{
+    int chromaWidth = width / 2;
+    int chromaHeight = height / 2;
+
+    unsigned char* y = planes;
+    unsigned char* u = y + (size_t)width * height;
+    unsigned char* v = u + (size_t)chromaWidth * chromaHeight;
+    const Color* src = pixels;
+
+    for (int i = 0; i < width * height; i++)
+        y[i] = (unsigned char)((77 * src[i].r + 150 * src[i].g + 29 * src[i].b + 128) >> 8);
+
+    for (int cy = 0; cy < chromaHeight; cy++)
+    {
+        for (int cx = 0; cx < chromaWidth; cx++)
+        {
+            const Color* p = src + (size_t)cy * 2 * width + cx * 2;
+            int r = p[0].r + p[1].r + p[width].r + p[width + 1].r;
+            int g = p[0].g + p[1].g + p[width].g + p[width + 1].g;
+            int b = p[0].b + p[1].b + p[width].b + p[width + 1].b;
+
+            // Sums of 4 pixels: scale by 1/4 inside the shift
+            u[cy * chromaWidth + cx] = ClampByte(((-43 * r - 85 * g + 128 * b + 512) >> 10) + 128);
+            v[cy * chromaWidth + cx] = ClampByte(((128 * r - 107 * g - 21 * b + 512) >> 10) + 128);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "raylib.h"
+#include <cstdio>
+
+// Background frame capture to a PNG sequence or a raw Y4M video stream.
+// CaptureFrame copies the finished frame into a pooled buffer and returns; an encoder
+// thread converts and writes it. A CPU renderer can skip the copy: draw straight into
+// AcquireCaptureFrame's buffer and hand it back with SubmitCaptureFrame. OpenGL frames go
+// through CaptureScreenReadback: read asynchronously into pixel buffers (ScreenReadback.h)
+// and copied from there into a pool buffer a couple of frames later, the only copy.
+// When every buffer is still queued (encoder behind) the frame is dropped, the game
+// never waits on disk or compression.
+// NOTE: Y4M is 4:2:0 BT.601 full range (C420jpeg), width and height should be even.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    CAPTURE_PNG = 0,        // One file per frame, path has one %d for the frame ("frame_%05d.png"), or none ("frame.png" is frame_00000.png...)
+    CAPTURE_Y4M             // Single raw video stream, path is the file name
+} CaptureFormat;
+
+typedef struct FrameCapture FrameCapture;   // Owns the buffers and the encoder thread
+typedef struct ScreenReadback ScreenReadback;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+FrameCapture* StartCapture(const char* path, CaptureFormat format, int width, int height, int fps, int bufferCount);  // nullptr if path can't be used
+bool CaptureFrame(FrameCapture* capture, const Color* pixels);     // Queue copy of RGBA frame, false if dropped
+Color* AcquireCaptureFrame(FrameCapture* capture);                  // Free width * height buffer, nullptr if dropped
+void SubmitCaptureFrame(FrameCapture* capture, Color* pixels);      // Queue an acquired buffer for encoding
+bool CaptureScreenReadback(FrameCapture* capture, ScreenReadback* readback, bool flush);   // Queue the back buffer, capture the one that is due; flush takes every queued frame instead
+void SkipCaptureFrame(FrameCapture* capture);                       // Count a frame that can't be captured as dropped
+void StopCapture(FrameCapture* capture);                            // Encode queued frames, print stats, free
+
+CaptureFormat GetCaptureFormat(const char* path);                   // CAPTURE_Y4M for *.y4m, else CAPTURE_PNG
+
+// Y4M stream pieces, for writers of their own (frames are "FRAME\n" followed by the planes)
+int WriteY4MHeader(FILE* file, int width, int height, int fps);    // Bytes written
+size_t Y4MFrameSize(int width, int height);                         // Planes of one frame, without "FRAME\n"
+void ConvertY4MFrame(const Color* pixels, int width, int height, unsigned char* planes);  // RGBA to Y, U, V planes
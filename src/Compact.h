@@ -0,0 +1,278 @@
+#pragma once
+#include "Math.h"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COMPACT_SSE2
+#endif
+
+#if defined(__F16C__) || defined(__AVX2__)
+#include <immintrin.h>
+#define COMPACT_F16C
+#endif
+
+// Compact storage types for large arrays of vectors (ball states, replay keyframes).
+// Simulate in float, store in these:
+//   - HalfVector2/HalfVector3: IEEE fp16 per component (half the bytes, ~3 significant digits)
+//   - QuantizedVector2: 16-bit fixed position inside an arena of known size
+//     (1200 x 800 arena -> 0.018 x 0.012 px steps, always in range)
+// The array Pack/Unpack functions use F16C (half) and SSE2 (quantized) when the compiler
+// targets them (/arch:AVX2 or -mf16c), with a scalar path otherwise.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct HalfVector2 {
+    uint16_t x;
+    uint16_t y;
+} HalfVector2;
+
+typedef struct HalfVector3 {
+    uint16_t x;
+    uint16_t y;
+    uint16_t z;
+} HalfVector3;
+
+// Position as a fraction of the arena, 0 = 0.0f and 65535 = arena extent
+typedef struct QuantizedVector2 {
+    uint16_t x;
+    uint16_t y;
+} QuantizedVector2;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Half precision
+//----------------------------------------------------------------------------------
+
+// Convert float to fp16 bits (round to nearest even, overflow to infinity)
+RMAPI uint16_t ToHalf(float value)
+{
+    uint32_t f = 0;
+    memcpy(&f, &value, sizeof(f));
+
+    uint32_t sign = (f >> 16) & 0x8000;
+    uint32_t mantissa = f & 0x7FFFFF;
+    int32_t exponent = (int32_t)((f >> 23) & 0xFF) - 127 + 15;
+
+    // Infinity and NaN (keep NaN quiet)
+    if ((f & 0x7FFFFFFF) >= 0x7F800000) return (uint16_t)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    if (exponent >= 31) return (uint16_t)(sign | 0x7C00);
+
+    if (exponent <= 0)
+    {
+        // Subnormal half, or zero when too small
+        if (exponent < -10) return (uint16_t)sign;
+
+        mantissa |= 0x800000;
+        uint32_t shift = (uint32_t)(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1))) half++;
+
+        return (uint16_t)(sign | half);
+    }
+
+    uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+    uint32_t rest = mantissa & 0x1FFF;
+
+    // Carry may roll into the exponent, which is still the correct rounding (up to infinity)
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) half++;
+
+    return (uint16_t)half;
+}
+
+// Convert fp16 bits to float (exact)
+RMAPI float FromHalf(uint16_t value)
+{
+    uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+    uint32_t exponent = (value >> 10) & 0x1F;
+    uint32_t mantissa = value & 0x3FF;
+    uint32_t f = 0;
+
+    if (exponent == 0)
+    {
+        if (mantissa == 0) f = sign;
+        else
+        {
+            // Renormalize the subnormal
+            int32_t e = 1;
+            while (!(mantissa & 0x400))
+            {
+                mantissa <<= 1;
+                e--;
+            }
+            f = sign | ((uint32_t)(e + 112) << 23) | ((mantissa & 0x3FF) << 13);
+        }
+    }
+    else if (exponent == 31) f = sign | 0x7F800000 | (mantissa << 13);
+    else f = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+    float result = 0.0f;
+    memcpy(&result, &f, sizeof(result));
+
+    return result;
+}
+
+RMAPI HalfVector2 ToHalf(Vector2 v)
+{
+    HalfVector2 result = { ToHalf(v.x), ToHalf(v.y) };
+
+    return result;
+}
+
+RMAPI HalfVector3 ToHalf(Vector3 v)
+{
+    HalfVector3 result = { ToHalf(v.x), ToHalf(v.y), ToHalf(v.z) };
+
+    return result;
+}
+
+RMAPI Vector2 ToVector2(HalfVector2 v)
+{
+    Vector2 result = { FromHalf(v.x), FromHalf(v.y) };
+
+    return result;
+}
+
+RMAPI Vector3 ToVector3(HalfVector3 v)
+{
+    Vector3 result = { FromHalf(v.x), FromHalf(v.y), FromHalf(v.z) };
+
+    return result;
+}
+
+// Convert an array of floats to fp16
+RMAPI void PackHalf(const float* src, uint16_t* dst, int count)
+{
+    int i = 0;
+
+#if defined(COMPACT_F16C)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(dst + i), half);
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = ToHalf(src[i]);
+}
+
+// Convert an array of fp16 to floats
+RMAPI void UnpackHalf(const uint16_t* src, float* dst, int count)
+{
+    int i = 0;
+
+#if defined(COMPACT_F16C)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i half = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = FromHalf(src[i]);
+}
+
+RMAPI void PackHalf(const Vector2* src, HalfVector2* dst, int count)
+{
+    PackHalf(&src->x, &dst->x, count * 2);
+}
+
+RMAPI void UnpackHalf(const HalfVector2* src, Vector2* dst, int count)
+{
+    UnpackHalf(&src->x, &dst->x, count * 2);
+}
+
+RMAPI void PackHalf(const Vector3* src, HalfVector3* dst, int count)
+{
+    PackHalf(&src->x, &dst->x, count * 3);
+}
+
+RMAPI void UnpackHalf(const HalfVector3* src, Vector3* dst, int count)
+{
+    UnpackHalf(&src->x, &dst->x, count * 3);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Quantized arena positions
+//----------------------------------------------------------------------------------
+
+// Quantize position inside [0, arena] (clamped, NaN to 0)
+RMAPI QuantizedVector2 Quantize(Vector2 position, Vector2 arena)
+{
+    // Same operations as the SSE2 path (maxps then minps) so both give identical results,
+    // NaN fails the first compare and maps to 0
+    float x = position.x * (65535.0f / arena.x);
+    float y = position.y * (65535.0f / arena.y);
+    x = (x > 0.0f) ? x : 0.0f;
+    y = (y > 0.0f) ? y : 0.0f;
+    x = (x < 65535.0f) ? x : 65535.0f;
+    y = (y < 65535.0f) ? y : 65535.0f;
+
+    QuantizedVector2 result = { (uint16_t)(x + 0.5f), (uint16_t)(y + 0.5f) };
+
+    return result;
+}
+
+// Restore position from arena fraction
+RMAPI Vector2 Dequantize(QuantizedVector2 position, Vector2 arena)
+{
+    Vector2 result = { (float)position.x * (arena.x / 65535.0f), (float)position.y * (arena.y / 65535.0f) };
+
+    return result;
+}
+
+// Quantize an array of positions
+RMAPI void Quantize(const Vector2* src, QuantizedVector2* dst, int count, Vector2 arena)
+{
+    int i = 0;
+
+#if defined(COMPACT_SSE2)
+    // Four positions per iteration, two per register: (x0, y0, x1, y1)
+    __m128 scale = _mm_setr_ps(65535.0f / arena.x, 65535.0f / arena.y, 65535.0f / arena.x, 65535.0f / arena.y);
+    __m128 zero = _mm_setzero_ps();
+    __m128 top = _mm_set1_ps(65535.0f);
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128i bias = _mm_set1_epi32(32768);
+    __m128i flip = _mm_set1_epi16((short)0x8000);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(&src[i].x);
+        __m128 b = _mm_loadu_ps(&src[i + 2].x);
+        a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(a, scale), zero), top);
+        b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(b, scale), zero), top);
+
+        // SSE2 only packs signed: shift into int16 range, pack, flip back
+        __m128i ia = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(a, half)), bias);
+        __m128i ib = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(b, half)), bias);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_xor_si128(_mm_packs_epi32(ia, ib), flip));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = Quantize(src[i], arena);
+}
+
+// Dequantize an array of positions
+RMAPI void Dequantize(const QuantizedVector2* src, Vector2* dst, int count, Vector2 arena)
+{
+    int i = 0;
+
+#if defined(COMPACT_SSE2)
+    __m128 scale = _mm_setr_ps(arena.x / 65535.0f, arena.y / 65535.0f, arena.x / 65535.0f, arena.y / 65535.0f);
+    __m128i zero = _mm_setzero_si128();
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i q = _mm_loadu_si128((const __m128i*)&src[i]);
+        __m128 a = _mm_cvtepi32_ps(_mm_unpacklo_epi16(q, zero));
+        __m128 b = _mm_cvtepi32_ps(_mm_unpackhi_epi16(q, zero));
+        _mm_storeu_ps(&dst[i].x, _mm_mul_ps(a, scale));
+        _mm_storeu_ps(&dst[i + 2].x, _mm_mul_ps(b, scale));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = Dequantize(src[i], arena);
+}
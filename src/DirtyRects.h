@@ -0,0 +1,131 @@
+#pragma once
+#include "raylib.h"
+#include "RenderList.h"
+#include <cmath>
+#include <cstdio>
+
+// Screen areas that changed between two recorded frames.
+// Commands are compared slot by slot: where they differ, the bounds of both the old and the
+// new command are dirty. A pixel outside every dirty rectangle is covered by the same
+// commands in the same order in both frames, so it already shows the right color and only
+// the dirty rectangles need repainting (clear, then every command that touches them).
+// Overlapping rectangles are merged; past DIRTY_REGION_CAPACITY, or when the dirty area
+// gets large, the region falls back to the full screen.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int DIRTY_REGION_CAPACITY = 16;
+
+typedef struct DirtyRegion {
+    Rectangle rects[DIRTY_REGION_CAPACITY];     // Whole pixels, inside the screen, not overlapping
+    int count;
+    bool full;                                  // Redraw everything, rects are unused
+} DirtyRegion;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+inline bool RenderCommandEqual(const RenderCommand& a, const RenderCommand& b)
+{
+    // Live particles move every frame
+    if (a.type == RENDER_PARTICLES && b.type == RENDER_PARTICLES) return a.value == 0 && b.value == 0;
+
+    return a.type == b.type && ColorToInt(a.color) == ColorToInt(b.color) && a.rec.x == b.rec.x && a.rec.y == b.rec.y &&
+        a.rec.width == b.rec.width && a.rec.height == b.rec.height && a.format == b.format && a.value == b.value;
+}
+
+// Pixels a command can write to, measureText gives text widths (MeasureText or SoftMeasureText)
+inline Rectangle RenderCommandBounds(const RenderCommand& command, int (*measureText)(const char*, int), int width, int height)
+{
+    Rectangle result = { 0.0f, 0.0f, (float)width, (float)height };
+
+    if (command.type == RENDER_RECT || command.type == RENDER_PARTICLES) result = command.rec;
+    else if (command.type == RENDER_TEXT)
+    {
+        char text[128];
+        snprintf(text, sizeof(text), command.format, command.value);
+        int fontSize = (command.rec.height < 10.0f) ? 10 : (int)command.rec.height;
+        int lines = 1;
+        for (const char* c = text; *c != '\0'; c++) lines += (*c == '\n');
+
+        // Spacing after the last glyph is not included by measureText, pad one cell
+        result = { command.rec.x, command.rec.y, (float)(measureText(text, fontSize) + fontSize),
+            fontSize + (lines - 1) * fontSize * 1.5f };
+    }
+
+    // Grow to whole pixels and clip to the screen
+    float x0 = fmaxf(floorf(result.x), 0.0f);
+    float y0 = fmaxf(floorf(result.y), 0.0f);
+    float x1 = fminf(ceilf(result.x + result.width), (float)width);
+    float y1 = fminf(ceilf(result.y + result.height), (float)height);
+
+    return { x0, y0, fmaxf(x1 - x0, 0.0f), fmaxf(y1 - y0, 0.0f) };
+}
+
+inline void AddDirtyRect(DirtyRegion& region, Rectangle rec)
+{
+    if (region.full || rec.width <= 0.0f || rec.height <= 0.0f) return;
+
+    // Absorb every rectangle the new one overlaps, the union can overlap others, so repeat
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (int i = 0; i < region.count; i++)
+        {
+            Rectangle other = region.rects[i];
+            if (!CheckCollisionRecs(rec, other)) continue;
+
+            float x0 = fminf(rec.x, other.x);
+            float y0 = fminf(rec.y, other.y);
+            float x1 = fmaxf(rec.x + rec.width, other.x + other.width);
+            float y1 = fmaxf(rec.y + rec.height, other.y + other.height);
+            rec = { x0, y0, x1 - x0, y1 - y0 };
+
+            region.rects[i] = region.rects[--region.count];
+            merged = true;
+            break;
+        }
+    }
+
+    if (region.count == DIRTY_REGION_CAPACITY) region.full = true;
+    else region.rects[region.count++] = rec;
+}
+
+inline float DirtyArea(const DirtyRegion& region, int width, int height)
+{
+    if (region.full) return (float)width * height;
+
+    float area = 0.0f;
+    for (int i = 0; i < region.count; i++) area += region.rects[i].width * region.rects[i].height;
+
+    return area;
+}
+
+// Dirty area of current against previous; full when it covers more than fullRatio of the screen
+inline DirtyRegion DiffRenderLists(const RenderList& previous, const RenderList& current, int (*measureText)(const char*, int),
+    int width, int height, float fullRatio)
+{
+    DirtyRegion result = {};
+    int count = (previous.count > current.count) ? previous.count : current.count;
+
+    for (int i = 0; i < count && !result.full; i++)
+    {
+        bool inPrevious = i < previous.count;
+        bool inCurrent = i < current.count;
+        if (inPrevious && inCurrent && RenderCommandEqual(previous.commands[i], current.commands[i])) continue;
+
+        // A changed clear repaints everything
+        if ((inPrevious && previous.commands[i].type == RENDER_CLEAR) || (inCurrent && current.commands[i].type == RENDER_CLEAR))
+            result.full = true;
+
+        if (inPrevious) AddDirtyRect(result, RenderCommandBounds(previous.commands[i], measureText, width, height));
+        if (inCurrent) AddDirtyRect(result, RenderCommandBounds(current.commands[i], measureText, width, height));
+    }
+
+    if (!result.full && DirtyArea(result, width, height) > fullRatio * width * height) result.full = true;
+
+    return result;
+}
@@ -0,0 +1,48 @@
+#include "EmbeddedSounds.h"
+#include <cstring>
+
+#if defined(EMBED_SOUNDS)
+#include "EmbeddedSoundData.h"      // Generated: EMBEDDED_SOUNDS[], EMBEDDED_SOUND_COUNT
+#else
+static const EmbeddedSound* const EMBEDDED_SOUNDS = nullptr;
+static const int EMBEDDED_SOUND_COUNT = 0;
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+const EmbeddedSound* FindEmbeddedSound(const char* fileName)
+{
+    for (int i = 0; i < EMBEDDED_SOUND_COUNT; i++)
+        if (strcmp(EMBEDDED_SOUNDS[i].fileName, GetFileName(fileName)) == 0) return &EMBEDDED_SOUNDS[i];
+
+    return nullptr;
+}
+
+int GetEmbeddedSoundCount(void)
+{
+    return EMBEDDED_SOUND_COUNT;
+}
+
+Wave LoadEmbeddedWave(const EmbeddedSound& sound)
+{
+    if (sound.samples == nullptr) return LoadEmbeddedWaveFile(sound);
+
+    // Owned copy, so the wave unloads like any other
+    unsigned int size = sound.frameCount * sound.channels * (sound.sampleSize / 8);
+    Wave result = {};
+    result.frameCount = sound.frameCount;
+    result.sampleRate = sound.sampleRate;
+    result.sampleSize = sound.sampleSize;
+    result.channels = sound.channels;
+    result.data = MemAlloc(size);
+    memcpy(result.data, sound.samples, size);
+
+    return result;
+}
+
+Wave LoadEmbeddedWaveFile(const EmbeddedSound& sound)
+{
+    return LoadWaveFromMemory(".wav", sound.file, sound.fileSize);
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "raylib.h"
+
+// Sound files compiled into the executable, so the game starts without file I/O and from
+// any working directory. The build (EmbedSounds.targets) turns every EmbedSound item of the
+// project into byte arrays in $(IntDir)EmbeddedSoundData.h: the file as it is, and the
+// samples of its data chunk with their format, decoded at build time. Builds without that
+// step (EMBED_SOUNDS not defined) have no embedded sounds and load from disk.
+// LoadEmbeddedWave uses the decoded samples when there are any (no WAV parsing at all),
+// otherwise LoadWaveFromMemory on the embedded file.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct EmbeddedSound {
+    const char* fileName;           // As listed in the project, without directories
+    const unsigned char* file;      // Whole WAV file
+    int fileSize;
+    const unsigned char* samples;   // PCM of the data chunk, nullptr for formats other than PCM
+    unsigned int frameCount;
+    unsigned int sampleRate;
+    unsigned int sampleSize;        // Bits per sample
+    unsigned int channels;
+} EmbeddedSound;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+const EmbeddedSound* FindEmbeddedSound(const char* fileName);     // nullptr when not embedded
+int GetEmbeddedSoundCount(void);
+
+Wave LoadEmbeddedWave(const EmbeddedSound& sound);                  // Decoded samples if any, else parses the file
+Wave LoadEmbeddedWaveFile(const EmbeddedSound& sound);              // Always parses the file (LoadWaveFromMemory)
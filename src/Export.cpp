@@ -0,0 +1,183 @@
+#include "Export.h"
+#include "raylib.h"
+#include "Capture.h"
+#include "Game.h"
+#include "GameRender.h"
+#include "RenderList.h"
+#include "Replay.h"
+#include "SoftRender.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct ExportJob
+{
+    const Replay* replay;
+    const char* videoFile;
+    long long headerBytes;
+    int ticksPerFrame;
+    int framesPerSegment;
+    int frameCount;
+    int segmentCount;
+
+    std::atomic<int> nextSegment;
+    std::atomic<int> desyncs;           // Segments whose last state differs from the next keyframe
+    std::atomic<bool> failed;
+};
+
+//----------------------------------------------------------------------------------
+// Workers
+//----------------------------------------------------------------------------------
+
+// 64-bit offsets, a 10 minute video is tens of GB
+static bool SeekFile(FILE* file, long long offset)
+{
+#if defined(_WIN32)
+    return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+static void ExportSegments(ExportJob* job)
+{
+    const Replay& replay = *job->replay;
+    const float dt = 1.0f / replay.tickRate;
+    const int width = (int)SCREEN_WIDTH;
+    const int height = (int)SCREEN_HEIGHT;
+    const size_t frameSize = Y4MFrameSize(width, height);
+
+    FILE* video = fopen(job->videoFile, "r+b");
+    if (video == nullptr)
+    {
+        job->failed.store(true);
+        return;
+    }
+
+    SoftCanvas canvas = LoadSoftCanvas(width, height);
+    DirtyRenderer dirty = {};
+    dirty.canvas = &canvas;
+    dirty.fullRatio = 0.5f;
+    RenderBackend backend = SoftwareDirtyBackend(&dirty);
+    RenderList list = {};
+    std::vector<unsigned char> planes(frameSize);
+
+    for (int segment = job->nextSegment++; segment < job->segmentCount && !job->failed.load(); segment = job->nextSegment++)
+    {
+        int first = segment * job->framesPerSegment;
+        int last = std::min(first + job->framesPerSegment, job->frameCount);
+        int tick = segment * replay.keyframeInterval;
+        GameState state = replay.keyframes[segment];
+
+        if (!SeekFile(video, job->headerBytes + (long long)first * (6 + frameSize)))
+        {
+            job->failed.store(true);
+            break;
+        }
+
+        for (int frame = first; frame < last; frame++)
+        {
+            for (; tick < (frame + 1) * job->ticksPerFrame; tick++) StepGame(state, replay.keys[tick], dt);
+
+            RecordGame(state, nullptr, list);
+            DrawRenderList(backend, list);
+            ConvertY4MFrame((const Color*)canvas.pixels, width, height, planes.data());
+            if (fputs("FRAME\n", video) == EOF || fwrite(planes.data(), 1, frameSize, video) != frameSize)
+            {
+                job->failed.store(true);
+                break;
+            }
+        }
+
+        if (job->failed.load()) break;
+
+        // A full segment ends on the next keyframe, both should be the same state
+        if (last - first == job->framesPerSegment && segment + 1 < replay.keyframeCount && !ReplayKeyframeMatches(replay, segment + 1, state))
+            job->desyncs++;
+    }
+
+    if (fclose(video) != 0) job->failed.store(true);
+    UnloadSoftCanvas(canvas);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+int RunExport(const char* replayFile, const char* videoFile, int threads)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+
+    Replay replay = LoadReplay(replayFile);
+    if (replay.tickCount == 0)
+    {
+        printf("export: can't read replay %s\n", replayFile);
+        return 1;
+    }
+
+    int ticksPerFrame = replay.tickRate / EXPORT_FPS;
+    if (ticksPerFrame == 0 || replay.tickRate % EXPORT_FPS != 0 || replay.keyframeInterval % ticksPerFrame != 0)
+    {
+        printf("export: replay at %d ticks per second (keyframe every %d) doesn't fit %d FPS video\n", replay.tickRate,
+            replay.keyframeInterval, EXPORT_FPS);
+        UnloadReplay(replay);
+        return 1;
+    }
+
+    // Header first, workers open the file for writing at their own offsets
+    FILE* video = fopen(videoFile, "wb");
+    if (video == nullptr)
+    {
+        printf("export: can't open %s\n", videoFile);
+        UnloadReplay(replay);
+        return 1;
+    }
+    int headerBytes = WriteY4MHeader(video, (int)SCREEN_WIDTH, (int)SCREEN_HEIGHT, EXPORT_FPS);
+    if (fclose(video) != 0 || headerBytes < 0)
+    {
+        printf("export: writing %s failed\n", videoFile);
+        UnloadReplay(replay);
+        return 1;
+    }
+
+    ExportJob job;
+    job.replay = &replay;
+    job.videoFile = videoFile;
+    job.headerBytes = headerBytes;
+    job.ticksPerFrame = ticksPerFrame;
+    job.framesPerSegment = replay.keyframeInterval / ticksPerFrame;
+    job.frameCount = replay.tickCount / ticksPerFrame;
+    job.segmentCount = (job.frameCount + job.framesPerSegment - 1) / job.framesPerSegment;
+    job.nextSegment.store(0);
+    job.desyncs.store(0);
+    job.failed.store(false);
+
+    if (threads <= 0) threads = (int)std::thread::hardware_concurrency();
+    if (threads <= 0) threads = 1;
+    if (threads > job.segmentCount) threads = job.segmentCount;
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) workers.emplace_back(ExportSegments, &job);
+    for (std::thread& worker : workers) worker.join();
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    double played = (double)job.frameCount / EXPORT_FPS;
+    double megabytes = (headerBytes + (double)job.frameCount * (6 + Y4MFrameSize((int)SCREEN_WIDTH, (int)SCREEN_HEIGHT))) / 1e6;
+
+    printf("export: %d frames (%.1f s of play) in %d segments on %d threads\n", job.frameCount, played, job.segmentCount, threads);
+    printf("  %.2f s, %.0f frames per second (%.1fx real time), %.0f MB written\n", seconds, job.frameCount / seconds, played / seconds, megabytes);
+    if (job.desyncs.load() > 0)
+        printf("  %d segments didn't end on their keyframe, the replay doesn't play back on this build\n", job.desyncs.load());
+    if (job.failed.load()) printf("export: writing %s failed\n", videoFile);
+
+    UnloadReplay(replay);
+
+    return job.failed.load() ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+// Offline replay to video export on every core.
+// The replay is cut into segments at its keyframes. Worker threads take the segments in order
+// from a shared counter, step the game from the segment's keyframe, draw each frame with the
+// software rasterizer (dirty rectangles, one canvas per thread), convert it to Y4M 4:2:0 and
+// write it. Y4M frames all have the same size, so each segment's chunk is written straight at
+// its final place in the output file: the chunks end up concatenated without a second pass.
+// The video runs at EXPORT_FPS, the replay's tick rate must be a multiple of it; frame f shows
+// the state after (f + 1) * tickRate / EXPORT_FPS ticks.
+// Particles are not part of the replay, so the video has none.
+
+constexpr int EXPORT_FPS = 60;
+
+// threads 0 uses one per core; prints timings, returns non-zero on failure
+int RunExport(const char* replayFile, const char* videoFile, int threads);
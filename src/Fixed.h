@@ -0,0 +1,376 @@
+#pragma once
+#include "Math.h"
+#include <cstdint>
+
+// Deterministic Q16.16 fixed-point math for lockstep simulation and replay checks.
+// Every operation is integer-only, so results are bit-exact regardless of compiler,
+// FMA contraction or x87/SSE code generation. Floats appear only in the To/From
+// conversions, which belong at the edges of the sim (input and rendering).
+// NOTE: Assumes two's complement arithmetic shifts (true on every target we ship).
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+#define FIXED_HALF (1 << (FIXED_SHIFT - 1))
+
+// Binary angle: a full turn is 65536 units
+#define FIXED_ANGLE_TURN 65536
+#define FIXED_ANGLE_QUARTER 16384
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Q16.16 scalar
+typedef struct Fixed {
+    int32_t raw;
+} Fixed;
+
+// Q16.16 vector
+typedef struct FixedVector2 {
+    Fixed x;
+    Fixed y;
+} FixedVector2;
+
+// Angle in binary units (wraps naturally on overflow)
+typedef uint16_t FixedAngle;
+
+// Quarter-wave sine table, 256 steps over [0, PI/2] in Q16.16 (last entry padded for interpolation)
+static const int32_t FIXED_SIN_TABLE[258] = {
+    0, 402, 804, 1206, 1608, 2010, 2412, 2814, 3216, 3617, 4019, 4420,
+    4821, 5222, 5623, 6023, 6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+    9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391, 12785, 13180, 13573, 13966,
+    14359, 14751, 15143, 15534, 15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+    19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+    23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+    28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538, 30893, 31248, 31600, 31952,
+    32303, 32652, 33000, 33347, 33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+    36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002,
+    40320, 40636, 40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624, 46906, 47186,
+    47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+    50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398, 52639, 52878, 53114, 53349,
+    53581, 53812, 54040, 54267, 54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+    56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+    58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+    60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568, 61705, 61839, 61971, 62101,
+    62228, 62353, 62476, 62596, 62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+    63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501,
+    64571, 64639, 64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476, 65492, 65505,
+    65516, 65525, 65531, 65535, 65536, 65536
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Fixed scalar math
+//----------------------------------------------------------------------------------
+
+// Convert float to fixed (round to nearest)
+RMAPI Fixed ToFixed(float value)
+{
+    Fixed result = { (int32_t)(value * (float)FIXED_ONE + ((value < 0.0f) ? -0.5f : 0.5f)) };
+
+    return result;
+}
+
+// Convert integer to fixed
+RMAPI Fixed ToFixed(int value)
+{
+    Fixed result = { (int32_t)value * FIXED_ONE };
+
+    return result;
+}
+
+// Convert fixed to float
+RMAPI float ToFloat(Fixed value)
+{
+    float result = (float)value.raw * (1.0f / (float)FIXED_ONE);
+
+    return result;
+}
+
+// Add two fixed values
+RMAPI Fixed Add(Fixed a, Fixed b)
+{
+    Fixed result = { a.raw + b.raw };
+
+    return result;
+}
+
+// Subtract two fixed values (a - b)
+RMAPI Fixed Subtract(Fixed a, Fixed b)
+{
+    Fixed result = { a.raw - b.raw };
+
+    return result;
+}
+
+// Multiply two fixed values (round to nearest)
+RMAPI Fixed Multiply(Fixed a, Fixed b)
+{
+    Fixed result = { (int32_t)(((int64_t)a.raw * b.raw + FIXED_HALF) >> FIXED_SHIFT) };
+
+    return result;
+}
+
+// Divide two fixed values (truncates toward zero, b must not be zero)
+RMAPI Fixed Divide(Fixed a, Fixed b)
+{
+    Fixed result = { (int32_t)((int64_t)a.raw * FIXED_ONE / b.raw) };
+
+    return result;
+}
+
+// Negate fixed value
+RMAPI Fixed Negate(Fixed value)
+{
+    Fixed result = { -value.raw };
+
+    return result;
+}
+
+// Clamp fixed value
+RMAPI Fixed Clamp(Fixed value, Fixed min, Fixed max)
+{
+    Fixed result = (value.raw < min.raw) ? min : value;
+
+    if (result.raw > max.raw) result = max;
+
+    return result;
+}
+
+// Integer square root of a 64-bit value (floor)
+RMAPI uint32_t FixedIsqrt(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > value) bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else result >>= 1;
+
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+// Square root of a non-negative fixed value
+RMAPI Fixed Sqrt(Fixed value)
+{
+    Fixed result = { (value.raw > 0) ? (int32_t)FixedIsqrt((uint64_t)value.raw << FIXED_SHIFT) : 0 };
+
+    return result;
+}
+
+// Convert radians to binary angle (wraps)
+RMAPI FixedAngle ToFixedAngle(float radians)
+{
+    FixedAngle result = (FixedAngle)((int32_t)(radians * ((float)FIXED_ANGLE_TURN / (2.0f * PI))) & 0xFFFF);
+
+    return result;
+}
+
+// Sine of a binary angle, table lookup with linear interpolation (~1 LSB error)
+RMAPI Fixed Sin(FixedAngle angle)
+{
+    int32_t quadrant = angle >> 14;
+    int32_t phase = angle & (FIXED_ANGLE_QUARTER - 1);
+
+    // Odd quadrants run the quarter wave backwards
+    if (quadrant & 1) phase = FIXED_ANGLE_QUARTER - phase;
+
+    int32_t index = phase >> 6;
+    int32_t fraction = phase & 63;
+    int32_t a = FIXED_SIN_TABLE[index];
+    int32_t b = FIXED_SIN_TABLE[index + 1];
+    int32_t value = a + (((b - a) * fraction + 32) >> 6);
+
+    Fixed result = { (quadrant & 2) ? -value : value };
+
+    return result;
+}
+
+// Cosine of a binary angle
+RMAPI Fixed Cos(FixedAngle angle)
+{
+    Fixed result = Sin((FixedAngle)(angle + FIXED_ANGLE_QUARTER));
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - FixedVector2 math
+//----------------------------------------------------------------------------------
+
+// Convert float vector to fixed
+RMAPI FixedVector2 ToFixed(Vector2 v)
+{
+    FixedVector2 result = { ToFixed(v.x), ToFixed(v.y) };
+
+    return result;
+}
+
+// Convert fixed vector to float
+RMAPI Vector2 ToVector2(FixedVector2 v)
+{
+    Vector2 result = { ToFloat(v.x), ToFloat(v.y) };
+
+    return result;
+}
+
+// Add two vectors (v1 + v2)
+RMAPI FixedVector2 Add(FixedVector2 v1, FixedVector2 v2)
+{
+    FixedVector2 result = { Add(v1.x, v2.x), Add(v1.y, v2.y) };
+
+    return result;
+}
+
+// Subtract two vectors (v1 - v2)
+RMAPI FixedVector2 Subtract(FixedVector2 v1, FixedVector2 v2)
+{
+    FixedVector2 result = { Subtract(v1.x, v2.x), Subtract(v1.y, v2.y) };
+
+    return result;
+}
+
+// Scale vector (multiply by value)
+RMAPI FixedVector2 Scale(FixedVector2 v, Fixed scale)
+{
+    FixedVector2 result = { Multiply(v.x, scale), Multiply(v.y, scale) };
+
+    return result;
+}
+
+// Multiply vector by vector
+RMAPI FixedVector2 Multiply(FixedVector2 v1, FixedVector2 v2)
+{
+    FixedVector2 result = { Multiply(v1.x, v2.x), Multiply(v1.y, v2.y) };
+
+    return result;
+}
+
+// Negate vector
+RMAPI FixedVector2 Negate(FixedVector2 v)
+{
+    FixedVector2 result = { Negate(v.x), Negate(v.y) };
+
+    return result;
+}
+
+// Calculate two vectors dot product (single rounding)
+RMAPI Fixed Dot(FixedVector2 v1, FixedVector2 v2)
+{
+    int64_t sum = (int64_t)v1.x.raw * v2.x.raw + (int64_t)v1.y.raw * v2.y.raw;
+    Fixed result = { (int32_t)((sum + FIXED_HALF) >> FIXED_SHIFT) };
+
+    return result;
+}
+
+// Calculate vector length
+RMAPI Fixed Length(FixedVector2 v)
+{
+    uint64_t sum = (uint64_t)((int64_t)v.x.raw * v.x.raw) + (uint64_t)((int64_t)v.y.raw * v.y.raw);
+    Fixed result = { (int32_t)FixedIsqrt(sum) };
+
+    return result;
+}
+
+// Normalize provided vector
+RMAPI FixedVector2 Normalize(FixedVector2 v)
+{
+    FixedVector2 result = { 0 };
+    Fixed length = Length(v);
+
+    if (length.raw > 0)
+    {
+        result.x.raw = (int32_t)((int64_t)v.x.raw * FIXED_ONE / length.raw);
+        result.y.raw = (int32_t)((int64_t)v.y.raw * FIXED_ONE / length.raw);
+    }
+
+    return result;
+}
+
+// Clamp the components of the vector between
+// min and max values specified by the given vectors
+RMAPI FixedVector2 Clamp(FixedVector2 v, FixedVector2 min, FixedVector2 max)
+{
+    FixedVector2 result = { Clamp(v.x, min.x, max.x), Clamp(v.y, min.y, max.y) };
+
+    return result;
+}
+
+// Convert binary angle to direction
+RMAPI FixedVector2 Direction(FixedAngle angle)
+{
+    FixedVector2 result = { Cos(angle), Sin(angle) };
+
+    return result;
+}
+
+// Rotate vector by binary angle (table sine/cosine)
+RMAPI FixedVector2 Rotate(FixedVector2 v, FixedAngle angle)
+{
+    FixedVector2 result = { 0 };
+
+    int64_t cosres = Cos(angle).raw;
+    int64_t sinres = Sin(angle).raw;
+
+    result.x.raw = (int32_t)((v.x.raw * cosres - v.y.raw * sinres + FIXED_HALF) >> FIXED_SHIFT);
+    result.y.raw = (int32_t)((v.x.raw * sinres + v.y.raw * cosres + FIXED_HALF) >> FIXED_SHIFT);
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Global operator overloads
+//----------------------------------------------------------------------------------
+
+RMAPI Fixed operator+(const Fixed& a, const Fixed& b)
+{
+    return Add(a, b);
+}
+
+RMAPI Fixed operator-(const Fixed& a, const Fixed& b)
+{
+    return Subtract(a, b);
+}
+
+RMAPI Fixed operator*(const Fixed& a, const Fixed& b)
+{
+    return Multiply(a, b);
+}
+
+RMAPI Fixed operator/(const Fixed& a, const Fixed& b)
+{
+    return Divide(a, b);
+}
+
+RMAPI FixedVector2 operator+(const FixedVector2& a, const FixedVector2& b)
+{
+    return Add(a, b);
+}
+
+RMAPI FixedVector2 operator-(const FixedVector2& a, const FixedVector2& b)
+{
+    return Subtract(a, b);
+}
+
+RMAPI FixedVector2 operator*(const FixedVector2& a, const FixedVector2& b)
+{
+    return Multiply(a, b);
+}
+
+RMAPI FixedVector2 operator*(const FixedVector2& a, Fixed b)
+{
+    return Scale(a, b);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// Frame pacing on our side of the loop instead of SetTargetFPS.
+// WaitNextFrame sleeps until shortly before the frame's deadline and busy-waits the rest,
+// so the frame starts on time without the oversleep of a plain sleep or the CPU cost of
+// spinning the whole wait. Input is sampled right after the wait: MarkInput numbers the
+// sample, and MarkPresent (after EndDrawing) takes the number of the newest sample the
+// presented frame reflects, so latency covers the trip through the sim thread as well.
+// A pacer with fps 0 never waits (uncapped, for benchmarks).
+// NOTE: Keep SetTargetFPS at 0 (the default) so EndDrawing doesn't wait as well.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int PACER_SAMPLES = 4096;     // Most recent frames kept for percentiles
+constexpr int PACER_INPUTS = 16;        // Input samples a frame can lag behind and still be timed
+
+typedef struct PacerSamples {
+    float values[PACER_SAMPLES];        // Milliseconds, ring buffer
+    int count;                          // Samples added in total
+} PacerSamples;
+
+typedef struct FramePacer {
+    double periodMs;                    // 0 when uncapped
+    double spinMs;                      // Final part of the wait spent busy-waiting
+    std::chrono::steady_clock::time_point deadline;    // Start of the next frame
+    std::chrono::steady_clock::time_point inputs[PACER_INPUTS];    // Time of each recent input sample
+    unsigned int inputCount;            // Input samples taken, the newest one is number inputCount
+    unsigned int lastPresented;         // Newest input sample a presented frame showed
+    PacerSamples error;                 // Frame start minus deadline, not kept when uncapped
+    PacerSamples latency;               // Input sample to the present of the first frame showing it
+} FramePacer;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+inline void AddPacerSample(PacerSamples& samples, double ms)
+{
+    samples.values[samples.count % PACER_SAMPLES] = (float)ms;
+    samples.count++;
+}
+
+// Value below which the given fraction of the kept samples fall
+// NOTE: Sorts samples, call when done
+inline float PacerPercentile(PacerSamples& samples, float fraction)
+{
+    int count = std::min(samples.count, PACER_SAMPLES);
+    if (count == 0) return 0.0f;
+
+    std::sort(samples.values, samples.values + count);
+    int index = (int)(fraction * (count - 1) + 0.5f);
+
+    return samples.values[index];
+}
+
+// fps 0 never waits; spinMs covers the sleep granularity of the OS (1 ms is plenty with a 1 ms timer)
+inline FramePacer LoadFramePacer(int fps, double spinMs)
+{
+    FramePacer result = {};
+    result.periodMs = (fps > 0) ? 1000.0 / fps : 0.0;
+    result.spinMs = spinMs;
+    result.deadline = std::chrono::steady_clock::now();
+
+    return result;
+}
+
+inline void WaitNextFrame(FramePacer& pacer)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    if (pacer.periodMs <= 0.0) return;
+
+    Clock::time_point wake = pacer.deadline - std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(pacer.spinMs));
+    if (Clock::now() < wake) std::this_thread::sleep_until(wake);
+    while (Clock::now() < pacer.deadline) {}
+
+    Clock::time_point now = Clock::now();
+    AddPacerSample(pacer.error, std::chrono::duration<double, std::milli>(now - pacer.deadline).count());
+
+    // Next deadline one period on; a frame that ran over a whole period restarts the schedule
+    Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(pacer.periodMs));
+    pacer.deadline += period;
+    if (pacer.deadline < now) pacer.deadline = now + period;
+}
+
+// Number of this input sample, starting at 1
+inline unsigned int MarkInput(FramePacer& pacer)
+{
+    pacer.inputCount++;
+    pacer.inputs[pacer.inputCount % PACER_INPUTS] = std::chrono::steady_clock::now();
+
+    return pacer.inputCount;
+}
+
+// Frame showing the effect of input sample number input is on screen
+inline void MarkPresent(FramePacer& pacer, unsigned int input)
+{
+    if (input <= pacer.lastPresented || input > pacer.inputCount || pacer.inputCount - input >= PACER_INPUTS) return;
+    pacer.lastPresented = input;        // Frames drawn faster than the sim show it again, only the first one counts
+
+    std::chrono::steady_clock::time_point sampled = pacer.inputs[input % PACER_INPUTS];
+    AddPacerSample(pacer.latency, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sampled).count());
+}
+
+inline void PrintFramePacer(FramePacer& pacer)
+{
+    if (pacer.inputCount == 0) return;
+
+    if (pacer.periodMs > 0.0) printf("pacing: %u frames, %.3f ms period\n", pacer.inputCount, pacer.periodMs);
+    else printf("pacing: %u frames, uncapped\n", pacer.inputCount);
+    if (pacer.periodMs > 0.0) printf("  start error    p50 %.3f  p90 %.3f  p99 %.3f  max %.3f ms\n", PacerPercentile(pacer.error, 0.5f),
+        PacerPercentile(pacer.error, 0.9f), PacerPercentile(pacer.error, 0.99f), PacerPercentile(pacer.error, 1.0f));
+    printf("  input latency  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f ms\n", PacerPercentile(pacer.latency, 0.5f),
+        PacerPercentile(pacer.latency, 0.9f), PacerPercentile(pacer.latency, 0.99f), PacerPercentile(pacer.latency, 1.0f));
+}
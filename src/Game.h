@@ -0,0 +1,198 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include "Serve.h"
+
+// Pong rules and state, no drawing, audio or input polling.
+// StepGame advances one GameState by dt; whoever owns the state (the sim thread, or the
+// main loop when rendering in software) feeds it the held keys and draws copies of it.
+
+constexpr float SCREEN_WIDTH = 1200.0f;
+constexpr float SCREEN_HEIGHT = 800.0f;
+constexpr Vector2 CENTER{ SCREEN_WIDTH * 0.5f, SCREEN_HEIGHT * 0.5f };
+
+// Ball can move half the screen width per-second
+constexpr float BALL_SPEED = SCREEN_WIDTH * 0.5f;
+constexpr float BALL_SIZE = 40.0f;
+
+// Paddles can move half the screen height per-second
+constexpr float PADDLE_SPEED = SCREEN_HEIGHT * 0.5f;
+constexpr float PADDLE_WIDTH = 40.0f;
+constexpr float PADDLE_HEIGHT = 80.0f;
+
+constexpr int WIN_POINTS = 5;
+
+// Keys held during a step, combined as bit flags
+enum GameKey
+{
+    GAME_KEY_PLAYER1_UP = 1,        // W
+    GAME_KEY_PLAYER1_DOWN = 2,      // S
+    GAME_KEY_PLAYER2_UP = 4,        // E
+    GAME_KEY_PLAYER2_DOWN = 8       // D
+};
+
+struct Box
+{
+    float xMin;
+    float xMax;
+    float yMin;
+    float yMax;
+};
+
+struct GameState
+{
+    Vector2 ballPosition;
+    Vector2 ballDirection;
+    Vector2 paddle1Position;
+    Vector2 paddle2Position;
+
+    int player1Points;
+    int player2Points;
+    int volley;                 // [Main Choice Feature] Volleys between players.
+    int winner;                 // 0 while playing, then 1 or 2
+
+    // Sound triggers, count up; the owner of the audio device plays one sound per increase
+    unsigned int hitSounds;     // Ball hit a paddle (sfx1)
+    unsigned int pointSounds;   // Point scored (sfx3)
+
+    ServeRandom serve;
+    unsigned int tick;          // Steps taken
+};
+
+constexpr bool BoxOverlap(Box box1, Box box2)
+{
+    bool x = box1.xMax >= box2.xMin && box1.xMin <= box2.xMax;
+    bool y = box1.yMax >= box2.yMin && box1.yMin <= box2.yMax;
+    return x && y;
+}
+
+constexpr Rectangle BoxToRec(Box box)
+{
+    Rectangle rec = {};
+    rec.x = box.xMin;
+    rec.y = box.yMin;
+    rec.width = box.xMax - box.xMin;
+    rec.height = box.yMax - box.yMin;
+    return rec;
+}
+
+constexpr Box BallBox(Vector2 position)
+{
+    Box box = {};
+    box.xMin = position.x - BALL_SIZE * 0.5f;
+    box.xMax = position.x + BALL_SIZE * 0.5f;
+    box.yMin = position.y - BALL_SIZE * 0.5f;
+    box.yMax = position.y + BALL_SIZE * 0.5f;
+    return box;
+}
+
+constexpr Box PaddleBox(Vector2 position)
+{
+    Box box = {};
+    box.xMin = position.x - PADDLE_WIDTH * 0.5f;
+    box.xMax = position.x + PADDLE_WIDTH * 0.5f;
+    box.yMin = position.y - PADDLE_HEIGHT * 0.5f;
+    box.yMax = position.y + PADDLE_HEIGHT * 0.5f;
+    return box;
+}
+
+inline void ResetBall(ServeRandom& serve, Vector2& position, Vector2& direction)
+{
+    position = CENTER;
+    direction = ServeDirection(serve);                              // [Secondary Choice Feature] Serves stay within 0-60 degrees (SERVE_ANGLE_MAX)
+}                                                                   // of a random side, so the ball always has X-axis movement.
+
+inline GameState InitGame(uint32_t seed)
+{
+    GameState state = {};
+    state.serve = SeedServe(seed);
+    ResetBall(state.serve, state.ballPosition, state.ballDirection);
+
+    state.paddle1Position.x = SCREEN_WIDTH * 0.05f;
+    state.paddle2Position.x = SCREEN_WIDTH * 0.95f;
+    state.paddle1Position.y = state.paddle2Position.y = CENTER.y;
+
+    return state;
+}
+
+// [Main Choice Feature] Volley text shows while the count is 5 or 10
+constexpr bool ShowVolley(const GameState& state)
+{
+    return state.volley == 5 || state.volley == 10;
+}
+
+// Keys a simple computer player holds: each paddle follows the ball, within a dead zone of
+// a quarter paddle, so fast serves still get past it now and then
+inline unsigned int AutoKeys(const GameState& state)
+{
+    constexpr float deadZone = PADDLE_HEIGHT * 0.25f;
+    unsigned int keys = 0;
+
+    if (state.ballPosition.y < state.paddle1Position.y - deadZone) keys |= GAME_KEY_PLAYER1_UP;
+    if (state.ballPosition.y > state.paddle1Position.y + deadZone) keys |= GAME_KEY_PLAYER1_DOWN;
+    if (state.ballPosition.y < state.paddle2Position.y - deadZone) keys |= GAME_KEY_PLAYER2_UP;
+    if (state.ballPosition.y > state.paddle2Position.y + deadZone) keys |= GAME_KEY_PLAYER2_DOWN;
+
+    return keys;
+}
+
+// Advance one step, keys is a combination of GameKey flags
+// NOTE: Does nothing once there is a winner
+inline void StepGame(GameState& state, unsigned int keys, float dt)
+{
+    if (state.winner != 0) return;
+    state.tick++;
+
+    float ballDelta = BALL_SPEED * dt;
+    float paddleDelta = PADDLE_SPEED * dt;
+
+    // Move paddle with key input
+    if (keys & GAME_KEY_PLAYER1_UP)
+        state.paddle1Position.y -= paddleDelta;
+    if (keys & GAME_KEY_PLAYER1_DOWN)
+        state.paddle1Position.y += paddleDelta;
+    if (keys & GAME_KEY_PLAYER2_UP)             // [Secondary Choice Feature] Second player controls.
+        state.paddle2Position.y -= paddleDelta; // Because its much more fun with TWO players.
+    if (keys & GAME_KEY_PLAYER2_DOWN)
+        state.paddle2Position.y += paddleDelta;
+
+    constexpr float phh = PADDLE_HEIGHT * 0.5f;
+    state.paddle1Position.y = Clamp(state.paddle1Position.y, phh, SCREEN_HEIGHT - phh);
+    state.paddle2Position.y = Clamp(state.paddle2Position.y, phh, SCREEN_HEIGHT - phh);
+
+    // Change the ball's direction on-collision
+    // NOTE: The box stays at the pre-reset position for the rest of the step, it decides who scored
+    Vector2 ballPositionNext = state.ballPosition + state.ballDirection * ballDelta;
+    Box ballBox = BallBox(ballPositionNext);
+    Box paddle1Box = PaddleBox(state.paddle1Position);
+    Box paddle2Box = PaddleBox(state.paddle2Position);
+
+    if (ballBox.xMin < 0.0f || ballBox.xMax > SCREEN_WIDTH)
+        ResetBall(state.serve, state.ballPosition, state.ballDirection);
+
+    if (ballBox.xMax > SCREEN_WIDTH || ballBox.xMin < 0.0f)
+    {
+        if (ballBox.xMax > SCREEN_WIDTH) state.player1Points += 1;  // Ball on the right, 1 point to player 1.
+        else state.player2Points += 1;                              // Ball on the left, 1 point to player 2.
+        state.pointSounds++;
+        state.volley = 0;                                           // [Main Choice Feature] Resets volley count to 0.
+        state.paddle1Position.y = CENTER.y;                         // Paddles reset position.
+        state.paddle2Position.y = CENTER.y;
+    }
+
+    if (state.player1Points == WIN_POINTS) state.winner = 1;
+    if (state.player2Points == WIN_POINTS) state.winner = 2;
+    if (state.winner != 0) return;
+
+    if (ballBox.yMin < 0.0f || ballBox.yMax > SCREEN_HEIGHT)
+        state.ballDirection.y *= -1.0f;
+    if (BoxOverlap(ballBox, paddle1Box) || BoxOverlap(ballBox, paddle2Box))
+    {
+        state.volley++;
+        state.hitSounds++;
+        state.ballDirection.x *= -1.0f;
+    }
+
+    // Update ball position after collision resolution
+    state.ballPosition = state.ballPosition + state.ballDirection * ballDelta;
+}
@@ -0,0 +1,24 @@
+#include "GameRender.h"
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+void RecordGame(const GameState& state, const ParticlePool* particles, RenderList& list)
+{
+    ClearRenderList(list);
+    PushClear(list, BLACK);
+    PushText(list, "Player One: %i", state.player1Points, 20, 10, 20, GRAY);       // Draw score text for player 1 per tick.
+    PushText(list, "Player Two: %i", state.player2Points, 1050, 10, 20, GRAY);     // Draw score text for player 2 per tick.
+    if (ShowVolley(state))                                                          // [Main Choice Feature] When volley count is 5 or 10...
+        PushText(list, "%i Volleys!", state.volley, 500, 200, 50, SKYBLUE);         // [Main Choice Feature] Show text for number of volleys.
+    if (particles != nullptr)
+        PushParticles(list, *particles);                                            // Under the ball and paddles.
+    PushRect(list, BoxToRec(BallBox(state.ballPosition)), WHITE);
+    PushRect(list, BoxToRec(PaddleBox(state.paddle1Position)), WHITE);
+    PushRect(list, BoxToRec(PaddleBox(state.paddle2Position)), WHITE);
+    if (state.winner == 1)
+        PushText(list, "Player One Wins!", 0, 175, 250, 100, LIME);                 // End game text center screen.
+    if (state.winner == 2)
+        PushText(list, "Player Two Wins!", 0, 175, 250, 100, RED);
+}
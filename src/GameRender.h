@@ -0,0 +1,10 @@
+#pragma once
+#include "Game.h"
+#include "RenderList.h"
+
+// What a frame of the match shows: score, volley banner, particles, ball, paddles and the
+// winner's text, recorded into a RenderList for any backend to draw. Shared by the window,
+// the terminal view and the video export, so they all show the same frame.
+
+// Record what the frame shows, nothing is drawn yet; particles may be null
+void RecordGame(const GameState& state, const ParticlePool* particles, RenderList& list);
@@ -0,0 +1,79 @@
+#pragma once
+#include "raylib.h"
+#include <cstdio>
+
+// HUD label for one integer ("Player One: %i"), cached in a render texture.
+// The string is formatted and its glyphs drawn only when the value changes;
+// every other frame the label is a single textured quad.
+// NOTE: Load after InitWindow (needs a GL context). Call UpdateHudText outside
+// BeginDrawing/EndDrawing, it switches to the label's render texture.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct HudText {
+    const char* format;         // printf format with a single %i
+    int fontSize;
+    Color color;
+    int value;
+    bool valid;                 // Texture matches value
+    int width;                  // Text width in pixels
+    RenderTexture2D target;
+} HudText;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Create label, texture is built on the first update
+inline HudText LoadHudText(const char* format, int fontSize, Color color)
+{
+    HudText result = {};
+    result.format = format;
+    result.fontSize = fontSize;
+    result.color = color;
+
+    return result;
+}
+
+inline void UnloadHudText(HudText& hud)
+{
+    if (hud.target.id != 0) UnloadRenderTexture(hud.target);
+    hud.target = {};
+    hud.valid = false;
+}
+
+// Re-render the label if value changed
+inline void UpdateHudText(HudText& hud, int value)
+{
+    if (hud.valid && hud.value == value) return;
+
+    char text[64];
+    snprintf(text, sizeof(text), hud.format, value);
+    hud.width = MeasureText(text, hud.fontSize);
+
+    // Grow only, a shorter value reuses the texture
+    if (hud.target.id == 0 || hud.target.texture.width < hud.width)
+    {
+        if (hud.target.id != 0) UnloadRenderTexture(hud.target);
+        hud.target = LoadRenderTexture(hud.width, hud.fontSize);
+    }
+
+    // Default font glyphs are fully opaque or fully clear, so blending the texture
+    // afterwards gives the same pixels as DrawText
+    BeginTextureMode(hud.target);
+    ClearBackground(BLANK);
+    DrawText(text, 0, 0, hud.fontSize, hud.color);
+    EndTextureMode();
+
+    hud.value = value;
+    hud.valid = true;
+}
+
+// Draw cached label, top-left at (x, y) like DrawText
+inline void DrawHudText(const HudText& hud, int x, int y)
+{
+    // Render textures are stored bottom-up, flip with a negative source height
+    Rectangle source = { 0.0f, 0.0f, (float)hud.width, -(float)hud.fontSize };
+    DrawTextureRec(hud.target.texture, source, Vector2{ (float)x, (float)y }, WHITE);
+}
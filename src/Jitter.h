@@ -0,0 +1,65 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+// Interval timing of a periodic loop (sim ticks, rendered frames).
+// TickJitter is called once per iteration; the time between calls is compared with the
+// target period. Jitter is the standard deviation of the interval, late counts intervals
+// over 1.5x the target (a missed tick or frame).
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct JitterStats {
+    const char* name;
+    double targetMs;
+    std::chrono::steady_clock::time_point last;
+    int ticks;
+    int intervals;
+    int late;
+    double sumMs;
+    double sumSquaresMs;
+    double maxMs;
+} JitterStats;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+inline JitterStats LoadJitter(const char* name, double targetMs)
+{
+    JitterStats result = {};
+    result.name = name;
+    result.targetMs = targetMs;
+
+    return result;
+}
+
+inline void TickJitter(JitterStats& stats)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (stats.ticks++ > 0)
+    {
+        double ms = std::chrono::duration<double, std::milli>(now - stats.last).count();
+        stats.intervals++;
+        stats.sumMs += ms;
+        stats.sumSquaresMs += ms * ms;
+        if (ms > stats.maxMs) stats.maxMs = ms;
+        if (ms > stats.targetMs * 1.5) stats.late++;
+    }
+
+    stats.last = now;
+}
+
+inline void PrintJitter(const JitterStats& stats)
+{
+    if (stats.intervals == 0) return;
+
+    double mean = stats.sumMs / stats.intervals;
+    double variance = stats.sumSquaresMs / stats.intervals - mean * mean;
+
+    printf("%s: %d ticks, %.3f ms mean (target %.3f), %.3f ms jitter, %.3f ms max, %d late\n", stats.name, stats.ticks,
+        mean, stats.targetMs, sqrt(variance > 0.0 ? variance : 0.0), stats.maxMs, stats.late);
+}
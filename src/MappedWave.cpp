@@ -0,0 +1,227 @@
+#include "MappedWave.h"
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int MAPPED_FILE_CAPACITY = 16;
+
+struct MappedFile
+{
+    std::string fileName;           // As passed to MapWave, empty when the slot is free
+    const unsigned char* base;
+    size_t size;
+    int references;
+    MappedWave wave;                // Checked once, when mapped
+#if defined(_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+static MappedFile mappedFiles[MAPPED_FILE_CAPACITY];
+static std::mutex mappedMutex;      // Matches may map from their own threads
+
+//----------------------------------------------------------------------------------
+// Mapping
+//----------------------------------------------------------------------------------
+
+static bool MapFile(MappedFile& file, const char* fileName)
+{
+#if defined(_WIN32)
+    file.file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file.file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size = {};
+    file.mapping = (GetFileSizeEx(file.file, &size) && size.QuadPart > 0) ? CreateFileMappingA(file.file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    file.base = (file.mapping != nullptr) ? (const unsigned char*)MapViewOfFile(file.mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (file.base == nullptr)
+    {
+        if (file.mapping != nullptr) CloseHandle(file.mapping);
+        CloseHandle(file.file);
+        return false;
+    }
+    file.size = (size_t)size.QuadPart;
+
+    WIN32_MEMORY_RANGE_ENTRY range = { (void*)file.base, file.size };
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);     // Read ahead, so the first play doesn't wait on the disk
+#else
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    void* base = (fstat(fd, &info) == 0 && info.st_size > 0) ? mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    close(fd);                      // The mapping keeps the file open
+    if (base == MAP_FAILED) return false;
+
+    file.base = (const unsigned char*)base;
+    file.size = (size_t)info.st_size;
+    madvise(base, file.size, MADV_WILLNEED);    // Read ahead, so the first play doesn't wait on the disk
+#endif
+
+    return true;
+}
+
+static void UnmapFile(MappedFile& file)
+{
+#if defined(_WIN32)
+    UnmapViewOfFile(file.base);
+    CloseHandle(file.mapping);
+    CloseHandle(file.file);
+#else
+    munmap((void*)file.base, file.size);
+#endif
+}
+
+// Little-endian fields, like every platform the game builds for
+static unsigned int ReadU32(const unsigned char* at)
+{
+    unsigned int value;
+    memcpy(&value, at, sizeof(value));
+    return value;
+}
+
+static unsigned int ReadU16(const unsigned char* at)
+{
+    unsigned short value;
+    memcpy(&value, at, sizeof(value));
+    return value;
+}
+
+// Find fmt and data in the RIFF chunks, every size checked against the file
+static MappedWave CheckWave(const unsigned char* file, size_t size, const char* fileName)
+{
+    MappedWave result = {};
+    if (size < 12 || memcmp(file, "RIFF", 4) != 0 || memcmp(file + 8, "WAVE", 4) != 0)
+    {
+        printf("MapWave: %s is not a WAV file\n", fileName);
+        return result;
+    }
+
+    unsigned int format = 0;
+    unsigned int blockAlign = 0;
+    const unsigned char* data = nullptr;
+    size_t dataSize = 0;
+    for (size_t at = 12; at + 8 <= size; )
+    {
+        size_t chunkSize = ReadU32(file + at + 4);
+        if (chunkSize > size - at - 8) chunkSize = size - at - 8;     // Truncated file, keep what is there
+
+        if (memcmp(file + at, "fmt ", 4) == 0 && chunkSize >= 16)
+        {
+            format = ReadU16(file + at + 8);
+            result.channels = ReadU16(file + at + 10);
+            result.sampleRate = ReadU32(file + at + 12);
+            blockAlign = ReadU16(file + at + 20);
+            result.sampleSize = ReadU16(file + at + 22);
+        }
+        else if (memcmp(file + at, "data", 4) == 0 && data == nullptr)
+        {
+            data = file + at + 8;
+            dataSize = chunkSize;
+        }
+        at += 8 + chunkSize + (chunkSize & 1);
+    }
+
+    bool pcm = format == 1 && (result.sampleSize == 8 || result.sampleSize == 16);
+    bool float32 = format == 3 && result.sampleSize == 32;
+    if (!(pcm || float32) || result.channels < 1 || result.channels > 2 || blockAlign != result.channels * result.sampleSize / 8 || data == nullptr)
+    {
+        printf("MapWave: %s has no PCM samples to use in place (format %u, %u bits, %u channels)\n", fileName, format, result.sampleSize, result.channels);
+        return {};
+    }
+
+    result.data = data;
+    result.frameCount = (unsigned int)(dataSize / blockAlign);
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+MappedWave MapWave(const char* fileName)
+{
+    std::lock_guard<std::mutex> lock(mappedMutex);
+
+    int slot = -1;
+    for (int i = 0; i < MAPPED_FILE_CAPACITY; i++)
+    {
+        MappedFile& file = mappedFiles[i];
+        if (file.references > 0 && file.fileName == fileName)
+        {
+            file.references++;
+            return file.wave;
+        }
+        if (file.references == 0 && slot < 0) slot = i;
+    }
+
+    MappedWave result = {};
+    result.mapping = -1;
+    if (slot < 0)
+    {
+        printf("MapWave: more than %d files mapped, %s not loaded\n", MAPPED_FILE_CAPACITY, fileName);
+        return result;
+    }
+
+    MappedFile& file = mappedFiles[slot];
+    if (!MapFile(file, fileName)) return result;
+
+    result = CheckWave(file.base, file.size, fileName);
+    if (result.data == nullptr)
+    {
+        UnmapFile(file);
+        result.mapping = -1;
+        return result;
+    }
+
+    result.mapping = slot;
+    file.fileName = fileName;
+    file.references = 1;
+    file.wave = result;
+
+    return result;
+}
+
+void UnmapWave(MappedWave wave)
+{
+    if (wave.data == nullptr) return;      // Empty, or never mapped
+
+    std::lock_guard<std::mutex> lock(mappedMutex);
+    MappedFile& file = mappedFiles[wave.mapping];
+    if (--file.references > 0) return;
+
+    UnmapFile(file);
+    file.fileName.clear();
+}
+
+size_t GetResidentMemory(void)
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.WorkingSetSize : 0;
+#else
+    size_t pages = 0;
+    size_t resident = 0;
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (statm == nullptr) return 0;
+    bool parsed = fscanf(statm, "%zu %zu", &pages, &resident) == 2;
+    fclose(statm);
+    return parsed ? resident * (size_t)sysconf(_SC_PAGESIZE) : 0;
+#endif
+}
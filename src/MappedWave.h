@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+
+// WAV files mapped into memory instead of read: the RIFF chunks are checked where they lie and
+// the samples are used in place, nothing is copied or decoded. Mapping the same file again
+// (another match in this process) shares the mapping, and the pages are shared with every
+// other process mapping it through the OS file cache. Only uncompressed PCM (8 or 16-bit)
+// and 32-bit float files can be used this way.
+// Played by streaming voices (AddVoiceStream in VoicePool.h), which copy from the mapping
+// straight into the mixer's buffers.
+// NOTE: No raylib.h here, the Windows headers it clashes with are needed in MappedWave.cpp.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct MappedWave {
+    const void* data;               // Samples of the data chunk, inside the read-only mapping
+    unsigned int frameCount;
+    unsigned int sampleRate;
+    unsigned int sampleSize;        // Bits per sample, 32 is float
+    unsigned int channels;
+    int mapping;                    // Shared mapping it lives in, -1 for none
+} MappedWave;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MappedWave MapWave(const char* fileName);       // Empty wave (data nullptr) if missing or not a usable WAV
+void UnmapWave(MappedWave wave);                // The mapping closes with its last wave
+
+size_t GetResidentMemory(void);                 // Resident set (working set) of the process in bytes, 0 if unknown
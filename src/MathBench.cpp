@@ -0,0 +1,671 @@
+#include "Fixed.h"
+#include <chrono>
+#include <cfloat>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Accuracy and throughput harness for Math.h and its optimized variants (fast trig, fixed point).
+// Every case runs a float function over randomized inputs and compares it against a double
+// precision reference evaluated on the same inputs, then times the float function alone.
+// Results go to stdout and to math_report.json so a replacement can be checked automatically:
+// a variant is safe when its max_ulp / max_rel_error stay within the tolerance of the case it replaces.
+
+typedef std::chrono::high_resolution_clock MathBenchClock;
+
+#define MATH_BENCH_SAMPLES 100000
+#define MATH_BENCH_PASSES 20
+#define MATH_BENCH_ULP_FLOOR 1.0f       // Ulps of results smaller than this are measured at this size
+
+struct MathCaseResult
+{
+    const char* name;
+    double maxUlp;          // Distance to the reference in float ulps at the reference, or at MATH_BENCH_ULP_FLOOR if smaller
+    double maxRelError;     // Relative error, only where |reference| > 1e-6
+    double maxAbsError;
+    int nanMismatches;      // One side NaN and the other not
+    double nsPerCall;
+};
+
+static std::vector<MathCaseResult> mathResults;
+static volatile float mathSink = 0.0f;
+
+//----------------------------------------------------------------------------------
+// Harness
+//----------------------------------------------------------------------------------
+
+// Error of value in float ulps at expected, with an absolute floor: results that cancel
+// to near zero (dot products, rotations) would otherwise count a tiny absolute error in
+// ulps of a denormal-sized value
+static double UlpError(float value, double expected)
+{
+    float e = fmaxf(fabsf((float)expected), MATH_BENCH_ULP_FLOOR);
+    double ulp = (double)nextafterf(e, FLT_MAX) - (double)e;
+
+    return fabs((double)value - expected) / ulp;
+}
+
+// Leaves inputs as drawn
+static void NoPrepare(float*) {}
+
+template <int In, int Out, typename P, typename F, typename R>
+static void RunCase(const char* name, float lo, float hi, P prepare, F function, R reference)
+{
+    std::vector<float> inputs(MATH_BENCH_SAMPLES * In);
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> dist(lo, hi);
+    for (int s = 0; s < MATH_BENCH_SAMPLES; s++)
+    {
+        for (int i = 0; i < In; i++) inputs[s * In + i] = dist(rng);
+        prepare(&inputs[s * In]);
+    }
+
+    MathCaseResult result = { name, 0.0, 0.0, 0.0, 0, 0.0 };
+    for (int s = 0; s < MATH_BENCH_SAMPLES; s++)
+    {
+        float out[Out] = {};
+        double din[In] = {};
+        double expect[Out] = {};
+        for (int i = 0; i < In; i++) din[i] = inputs[s * In + i];
+
+        function(&inputs[s * In], out);
+        reference(din, expect);
+
+        for (int o = 0; o < Out; o++)
+        {
+            if (isnan(out[o]) || isnan(expect[o]))
+            {
+                if (isnan(out[o]) != isnan(expect[o])) result.nanMismatches++;
+                continue;
+            }
+
+            double absError = fabs((double)out[o] - expect[o]);
+            result.maxAbsError = fmax(result.maxAbsError, absError);
+            result.maxUlp = fmax(result.maxUlp, UlpError(out[o], expect[o]));
+            if (fabs(expect[o]) > 1e-6) result.maxRelError = fmax(result.maxRelError, absError / fabs(expect[o]));
+        }
+    }
+
+    float sink = 0.0f;
+    MathBenchClock::time_point start = MathBenchClock::now();
+    for (int pass = 0; pass < MATH_BENCH_PASSES; pass++)
+    {
+        for (int s = 0; s < MATH_BENCH_SAMPLES; s++)
+        {
+            float out[Out] = {};
+            function(&inputs[s * In], out);
+            sink += out[0];
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(MathBenchClock::now() - start).count();
+    mathSink = sink;
+
+    result.nsPerCall = ns / ((double)MATH_BENCH_PASSES * MATH_BENCH_SAMPLES);
+    mathResults.push_back(result);
+}
+
+template <int In, int Out, typename F, typename R>
+static void RunCase(const char* name, float lo, float hi, F function, R reference)
+{
+    RunCase<In, Out>(name, lo, hi, NoPrepare, function, reference);
+}
+
+// JSON number, non-finite values become null
+static void WriteJsonNumber(FILE* file, double value)
+{
+    if (isfinite(value)) fprintf(file, "%.6g", value);
+    else fprintf(file, "null");
+}
+
+static void WriteReport(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    if (file == NULL)
+    {
+        printf("math: could not write %s\n", path);
+        return;
+    }
+
+    fprintf(file, "{\n  \"samples\": %d,\n  \"passes\": %d,\n  \"ulp_floor\": %g,\n  \"functions\": [\n", MATH_BENCH_SAMPLES, MATH_BENCH_PASSES,
+        MATH_BENCH_ULP_FLOOR);
+    for (size_t i = 0; i < mathResults.size(); i++)
+    {
+        const MathCaseResult& r = mathResults[i];
+        fprintf(file, "    { \"name\": \"%s\", \"max_ulp\": ", r.name);
+        WriteJsonNumber(file, r.maxUlp);
+        fprintf(file, ", \"max_rel_error\": ");
+        WriteJsonNumber(file, r.maxRelError);
+        fprintf(file, ", \"max_abs_error\": ");
+        WriteJsonNumber(file, r.maxAbsError);
+        fprintf(file, ", \"nan_mismatches\": %d, \"ns_per_call\": ", r.nanMismatches);
+        WriteJsonNumber(file, r.nsPerCall);
+        fprintf(file, " }%s\n", (i + 1 < mathResults.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+
+    printf("math: wrote %s\n", path);
+}
+
+//----------------------------------------------------------------------------------
+// Input/output helpers
+//----------------------------------------------------------------------------------
+static Vector2 V2(const float* a) { return Vector2{ a[0], a[1] }; }
+static Vector3 V3(const float* a) { return Vector3{ a[0], a[1], a[2] }; }
+static Quaternion Q(const float* a) { return Quaternion{ a[0], a[1], a[2], a[3] }; }
+static Matrix M(const float* a)
+{
+    Matrix m = { 0 };
+    float* f = &m.m0;
+
+    // Matrix fields are declared row by row, input index k maps to field mk
+    const int field[16] = { 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 };
+    for (int k = 0; k < 16; k++) f[field[k]] = a[k];
+
+    return m;
+}
+
+static void Out(Vector2 v, float* r) { r[0] = v.x; r[1] = v.y; }
+static void Out(Vector3 v, float* r) { r[0] = v.x; r[1] = v.y; r[2] = v.z; }
+static void Out(Quaternion q, float* r) { r[0] = q.x; r[1] = q.y; r[2] = q.z; r[3] = q.w; }
+static void Out(Matrix m, float* r) { float16 f = ToFloatV(m); for (int k = 0; k < 16; k++) r[k] = f.v[k]; }
+
+static void NormalizeInPlace(float* a, int n)
+{
+    float length = 0.0f;
+    for (int i = 0; i < n; i++) length += a[i] * a[i];
+    length = sqrtf(length);
+    for (int i = 0; i < n; i++) a[i] /= length;
+}
+
+// Triangle a, b, c (9 floats) whose corner at a is under ~15 degrees (or a zero edge) gets
+// c moved square to ab, barycentric coordinates of near-flat triangles blow up in any precision
+static void ReshapeDegenerate(float* t)
+{
+    float e0[3] = { t[3] - t[0], t[4] - t[1], t[5] - t[2] };
+    float e1[3] = { t[6] - t[0], t[7] - t[1], t[8] - t[2] };
+    float n[3] = { e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0] };
+    float l0 = e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2];
+    float l1 = e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2];
+    float ln = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+    if (ln > 0.0625f * l0 * l1 && l0 > 1.0f) return;
+    if (l0 <= 1.0f) e0[0] += 10.0f;
+
+    // Cross with the axis e0 is least along, never parallel to it
+    int k = (fabsf(e0[0]) <= fabsf(e0[1]) && fabsf(e0[0]) <= fabsf(e0[2])) ? 0 : (fabsf(e0[1]) <= fabsf(e0[2])) ? 1 : 2;
+    float axis[3] = { k == 0 ? 1.0f : 0.0f, k == 1 ? 1.0f : 0.0f, k == 2 ? 1.0f : 0.0f };
+    t[3] = t[0] + e0[0];
+    t[4] = t[1] + e0[1];
+    t[5] = t[2] + e0[2];
+    t[6] = t[0] + e0[1] * axis[2] - e0[2] * axis[1];
+    t[7] = t[1] + e0[2] * axis[0] - e0[0] * axis[2];
+    t[8] = t[2] + e0[0] * axis[1] - e0[1] * axis[0];
+}
+
+static double DotD(const double* a, const double* b, int n)
+{
+    double result = 0.0;
+    for (int i = 0; i < n; i++) result += a[i] * b[i];
+    return result;
+}
+
+static void CrossD(const double* a, const double* b, double* r)
+{
+    r[0] = a[1] * b[2] - a[2] * b[1];
+    r[1] = a[2] * b[0] - a[0] * b[2];
+    r[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static void NormalizeD(const double* a, double* r, int n)
+{
+    double length = sqrt(DotD(a, a, n));
+    for (int i = 0; i < n; i++) r[i] = (length > 0.0) ? a[i] / length : 0.0;
+}
+
+// r = a * b with element k of the column-major float16 layout
+static void MultiplyD(const double* a, const double* b, double* r)
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            r[4 * i + j] = a[4 * i] * b[j] + a[4 * i + 1] * b[4 + j] + a[4 * i + 2] * b[8 + j] + a[4 * i + 3] * b[12 + j];
+}
+
+// Gauss-Jordan inverse with partial pivoting, returns determinant
+static double InvertD(const double* a, double* r)
+{
+    double m[4][8] = {};
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++) m[i][j] = a[4 * i + j];
+        m[i][4 + i] = 1.0;
+    }
+
+    double det = 1.0;
+    for (int c = 0; c < 4; c++)
+    {
+        int pivot = c;
+        for (int i = c + 1; i < 4; i++) if (fabs(m[i][c]) > fabs(m[pivot][c])) pivot = i;
+        if (pivot != c)
+        {
+            for (int j = 0; j < 8; j++) { double t = m[c][j]; m[c][j] = m[pivot][j]; m[pivot][j] = t; }
+            det = -det;
+        }
+
+        double p = m[c][c];
+        det *= p;
+        for (int j = 0; j < 8; j++) m[c][j] /= p;
+        for (int i = 0; i < 4; i++)
+        {
+            if (i == c) continue;
+            double f = m[i][c];
+            for (int j = 0; j < 8; j++) m[i][j] -= f * m[c][j];
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++) r[4 * i + j] = m[i][4 + j];
+
+    return det;
+}
+
+// Rotation matrix around a normalized axis (same layout as Rotate(Vector3, float))
+static void RotationD(double x, double y, double z, double angle, double* r)
+{
+    double s = sin(angle);
+    double c = cos(angle);
+    double t = 1.0 - c;
+
+    double m[16] = {
+        x * x * t + c,     y * x * t + z * s, z * x * t - y * s, 0.0,
+        x * y * t - z * s, y * y * t + c,     z * y * t + x * s, 0.0,
+        x * z * t + y * s, y * z * t - x * s, z * z * t + c,     0.0,
+        0.0, 0.0, 0.0, 1.0
+    };
+    for (int k = 0; k < 16; k++) r[k] = m[k];
+}
+
+// Rotate v by unit quaternion q (x, y, z, w)
+static void RotateD(const double* v, const double* q, double* r)
+{
+    double u[3] = { q[0], q[1], q[2] };
+    double uv[3], uuv[3];
+    CrossD(u, v, uv);
+    CrossD(u, uv, uuv);
+    for (int i = 0; i < 3; i++) r[i] = v[i] + 2.0 * (q[3] * uv[i] + uuv[i]);
+}
+
+//----------------------------------------------------------------------------------
+// Cases
+//----------------------------------------------------------------------------------
+static void ScalarCases()
+{
+    RunCase<3, 1>("Lerp(float)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Lerp(a[0], a[1], a[2]); },
+        [](const double* a, double* r) { r[0] = a[0] + a[2] * (a[1] - a[0]); });
+    RunCase<3, 1>("Normalize(float)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Normalize(a[0], a[1], a[2]); },
+        [](const double* a, double* r) { r[0] = (a[0] - a[1]) / (a[2] - a[1]); });
+    RunCase<5, 1>("Remap", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Remap(a[0], a[1], a[2], a[3], a[4]); },
+        [](const double* a, double* r) { r[0] = (a[0] - a[1]) / (a[2] - a[1]) * (a[4] - a[3]) + a[3]; });
+    RunCase<3, 1>("Wrap", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Wrap(a[0], a[1], a[2]); },
+        [](const double* a, double* r) { r[0] = a[0] - (a[2] - a[1]) * floor((a[0] - a[1]) / (a[2] - a[1])); });
+    RunCase<3, 1>("Clamp(float)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Clamp(a[0], a[1], a[2]); },
+        [](const double* a, double* r) { double v = (a[0] < a[1]) ? a[1] : a[0]; r[0] = (v > a[2]) ? a[2] : v; });
+}
+
+static void Vector2Cases()
+{
+    RunCase<4, 2>("Add(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Add(V2(a), V2(a + 2)), r); },
+        [](const double* a, double* r) { r[0] = a[0] + a[2]; r[1] = a[1] + a[3]; });
+    RunCase<4, 2>("Subtract(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Subtract(V2(a), V2(a + 2)), r); },
+        [](const double* a, double* r) { r[0] = a[0] - a[2]; r[1] = a[1] - a[3]; });
+    RunCase<3, 2>("Scale(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Scale(V2(a), a[2]), r); },
+        [](const double* a, double* r) { r[0] = a[0] * a[2]; r[1] = a[1] * a[2]; });
+    RunCase<4, 2>("Divide(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Divide(V2(a), V2(a + 2)), r); },
+        [](const double* a, double* r) { r[0] = a[0] / a[2]; r[1] = a[1] / a[3]; });
+    RunCase<2, 1>("Length(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Length(V2(a)); },
+        [](const double* a, double* r) { r[0] = sqrt(DotD(a, a, 2)); });
+    RunCase<4, 1>("Dot(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Dot(V2(a), V2(a + 2)); },
+        [](const double* a, double* r) { r[0] = DotD(a, a + 2, 2); });
+    RunCase<4, 1>("Cross(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Cross(V2(a), V2(a + 2)); },
+        [](const double* a, double* r) { r[0] = a[0] * a[3] - a[1] * a[2]; });
+    RunCase<4, 1>("Distance(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Distance(V2(a), V2(a + 2)); },
+        [](const double* a, double* r) { r[0] = sqrt((a[0] - a[2]) * (a[0] - a[2]) + (a[1] - a[3]) * (a[1] - a[3])); });
+    RunCase<2, 2>("Normalize(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Normalize(V2(a)), r); },
+        [](const double* a, double* r) { NormalizeD(a, r, 2); });
+    RunCase<1, 2>("Direction", -PI, PI,
+        [](const float* a, float* r) { Out(Direction(a[0]), r); },
+        [](const double* a, double* r) { r[0] = cos(a[0]); r[1] = sin(a[0]); });
+    RunCase<2, 1>("Angle(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Angle(V2(a)); },
+        [](const double* a, double* r) { r[0] = atan2(a[1], a[0]); });
+    RunCase<3, 2>("Rotate(Vector2)", -PI, PI,
+        [](const float* a, float* r) { Out(Rotate(V2(a), a[2]), r); },
+        [](const double* a, double* r) { r[0] = a[0] * cos(a[2]) - a[1] * sin(a[2]); r[1] = a[0] * sin(a[2]) + a[1] * cos(a[2]); });
+    RunCase<4, 1>("UnsignedAngle", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 2); NormalizeInPlace(a + 2, 2); },
+        [](const float* a, float* r) { r[0] = UnsignedAngle(V2(a), V2(a + 2)); },
+        [](const double* a, double* r) { r[0] = acos(fmin(1.0, fmax(-1.0, DotD(a, a + 2, 2)))); });
+    RunCase<4, 1>("SignedAngle", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 2); NormalizeInPlace(a + 2, 2); },
+        [](const float* a, float* r) { r[0] = SignedAngle(V2(a), V2(a + 2)); },
+        [](const double* a, double* r) { r[0] = atan2(a[0] * a[3] - a[1] * a[2], DotD(a, a + 2, 2)); });
+    RunCase<4, 2>("Reflect(Vector2)", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a + 2, 2); },
+        [](const float* a, float* r) { Out(Reflect(V2(a), V2(a + 2)), r); },
+        [](const double* a, double* r) { double d = DotD(a, a + 2, 2); r[0] = a[0] - 2.0 * a[2] * d; r[1] = a[1] - 2.0 * a[3] * d; });
+    RunCase<4, 2>("Project(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Project(V2(a), V2(a + 2)), r); },
+        [](const double* a, double* r) { double t = DotD(a, a + 2, 2) / DotD(a + 2, a + 2, 2); r[0] = t * a[2]; r[1] = t * a[3]; });
+    RunCase<6, 2>("ProjectPointLine(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(ProjectPointLine(V2(a), V2(a + 2), V2(a + 4)), r); },
+        [](const double* a, double* r)
+        {
+            double ab[2] = { a[2] - a[0], a[3] - a[1] };
+            double ap[2] = { a[4] - a[0], a[5] - a[1] };
+            double t = fmin(1.0, fmax(0.0, DotD(ap, ab, 2) / DotD(ab, ab, 2)));
+            r[0] = a[0] + ab[0] * t;
+            r[1] = a[1] + ab[1] * t;
+        });
+    RunCase<5, 2>("MoveTowards", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(MoveTowards(V2(a), V2(a + 2), a[4]), r); },
+        [](const double* a, double* r)
+        {
+            double dx = a[2] - a[0], dy = a[3] - a[1];
+            double value = dx * dx + dy * dy;
+            if (value == 0.0 || (a[4] >= 0.0 && value <= a[4] * a[4])) { r[0] = a[2]; r[1] = a[3]; return; }
+            double dist = sqrt(value);
+            r[0] = a[0] + dx / dist * a[4];
+            r[1] = a[1] + dy / dist * a[4];
+        });
+    RunCase<5, 2>("Lerp(Vector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Lerp(V2(a), V2(a + 2), a[4]), r); },
+        [](const double* a, double* r) { r[0] = a[0] + a[4] * (a[2] - a[0]); r[1] = a[1] + a[4] * (a[3] - a[1]); });
+}
+
+static void FastTrigCases()
+{
+    RunCase<1, 2>("Direction(TRIG_PRECISION_LOW)", -PI, PI,
+        [](const float* a, float* r) { Out(Direction(a[0], TRIG_PRECISION_LOW), r); },
+        [](const double* a, double* r) { r[0] = cos(a[0]); r[1] = sin(a[0]); });
+    RunCase<1, 2>("Direction(TRIG_PRECISION_MEDIUM)", -PI, PI,
+        [](const float* a, float* r) { Out(Direction(a[0], TRIG_PRECISION_MEDIUM), r); },
+        [](const double* a, double* r) { r[0] = cos(a[0]); r[1] = sin(a[0]); });
+    RunCase<1, 2>("Direction(TRIG_PRECISION_HIGH)", -PI, PI,
+        [](const float* a, float* r) { Out(Direction(a[0], TRIG_PRECISION_HIGH), r); },
+        [](const double* a, double* r) { r[0] = cos(a[0]); r[1] = sin(a[0]); });
+    RunCase<2, 1>("Angle(TRIG_PRECISION_LOW)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Angle(V2(a), TRIG_PRECISION_LOW); },
+        [](const double* a, double* r) { r[0] = atan2(a[1], a[0]); });
+    RunCase<2, 1>("Angle(TRIG_PRECISION_MEDIUM)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Angle(V2(a), TRIG_PRECISION_MEDIUM); },
+        [](const double* a, double* r) { r[0] = atan2(a[1], a[0]); });
+    RunCase<2, 1>("Angle(TRIG_PRECISION_HIGH)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Angle(V2(a), TRIG_PRECISION_HIGH); },
+        [](const double* a, double* r) { r[0] = atan2(a[1], a[0]); });
+    RunCase<3, 2>("Rotate(TRIG_PRECISION_LOW)", -PI, PI,
+        [](const float* a, float* r) { Out(Rotate(V2(a), a[2], TRIG_PRECISION_LOW), r); },
+        [](const double* a, double* r) { r[0] = a[0] * cos(a[2]) - a[1] * sin(a[2]); r[1] = a[0] * sin(a[2]) + a[1] * cos(a[2]); });
+    RunCase<3, 2>("Rotate(TRIG_PRECISION_MEDIUM)", -PI, PI,
+        [](const float* a, float* r) { Out(Rotate(V2(a), a[2], TRIG_PRECISION_MEDIUM), r); },
+        [](const double* a, double* r) { r[0] = a[0] * cos(a[2]) - a[1] * sin(a[2]); r[1] = a[0] * sin(a[2]) + a[1] * cos(a[2]); });
+    RunCase<3, 2>("Rotate(TRIG_PRECISION_HIGH)", -PI, PI,
+        [](const float* a, float* r) { Out(Rotate(V2(a), a[2], TRIG_PRECISION_HIGH), r); },
+        [](const double* a, double* r) { r[0] = a[0] * cos(a[2]) - a[1] * sin(a[2]); r[1] = a[0] * sin(a[2]) + a[1] * cos(a[2]); });
+}
+
+static void FixedCases()
+{
+    RunCase<1, 1>("Sin(FixedAngle)", -PI, PI,
+        [](const float* a, float* r) { r[0] = ToFloat(Sin(ToFixedAngle(a[0]))); },
+        [](const double* a, double* r) { r[0] = sin(a[0]); });
+    RunCase<1, 1>("Cos(FixedAngle)", -PI, PI,
+        [](const float* a, float* r) { r[0] = ToFloat(Cos(ToFixedAngle(a[0]))); },
+        [](const double* a, double* r) { r[0] = cos(a[0]); });
+    RunCase<3, 2>("Rotate(FixedVector2)", -PI, PI,
+        [](const float* a, float* r) { Out(ToVector2(Rotate(ToFixed(V2(a)), ToFixedAngle(a[2]))), r); },
+        [](const double* a, double* r) { r[0] = a[0] * cos(a[2]) - a[1] * sin(a[2]); r[1] = a[0] * sin(a[2]) + a[1] * cos(a[2]); });
+    RunCase<2, 2>("Normalize(FixedVector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(ToVector2(Normalize(ToFixed(V2(a)))), r); },
+        [](const double* a, double* r) { NormalizeD(a, r, 2); });
+    RunCase<2, 1>("Length(FixedVector2)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = ToFloat(Length(ToFixed(V2(a)))); },
+        [](const double* a, double* r) { r[0] = sqrt(DotD(a, a, 2)); });
+    RunCase<1, 1>("Sqrt(Fixed)", 0.0f, 1000.0f,
+        [](const float* a, float* r) { r[0] = ToFloat(Sqrt(ToFixed(a[0]))); },
+        [](const double* a, double* r) { r[0] = sqrt(a[0]); });
+}
+
+static void Vector3Cases()
+{
+    RunCase<6, 3>("Add(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Add(V3(a), V3(a + 3)), r); },
+        [](const double* a, double* r) { for (int i = 0; i < 3; i++) r[i] = a[i] + a[3 + i]; });
+    RunCase<6, 3>("Multiply(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Multiply(V3(a), V3(a + 3)), r); },
+        [](const double* a, double* r) { for (int i = 0; i < 3; i++) r[i] = a[i] * a[3 + i]; });
+    RunCase<6, 3>("Cross(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Cross(V3(a), V3(a + 3)), r); },
+        [](const double* a, double* r) { CrossD(a, a + 3, r); });
+    RunCase<6, 1>("Dot(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Dot(V3(a), V3(a + 3)); },
+        [](const double* a, double* r) { r[0] = DotD(a, a + 3, 3); });
+    RunCase<3, 1>("Length(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Length(V3(a)); },
+        [](const double* a, double* r) { r[0] = sqrt(DotD(a, a, 3)); });
+    RunCase<6, 1>("Distance(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Distance(V3(a), V3(a + 3)); },
+        [](const double* a, double* r) { double d[3] = { a[0] - a[3], a[1] - a[4], a[2] - a[5] }; r[0] = sqrt(DotD(d, d, 3)); });
+    RunCase<3, 3>("Normalize(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Normalize(V3(a)), r); },
+        [](const double* a, double* r) { NormalizeD(a, r, 3); });
+    RunCase<6, 1>("Angle(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { r[0] = Angle(V3(a), V3(a + 3)); },
+        [](const double* a, double* r) { double c[3]; CrossD(a, a + 3, c); r[0] = atan2(sqrt(DotD(c, c, 3)), DotD(a, a + 3, 3)); });
+    RunCase<7, 3>("Rotate(Vector3, axis, angle)", -PI, PI,
+        [](const float* a, float* r) { Out(Rotate(V3(a), V3(a + 3), a[6]), r); },
+        [](const double* a, double* r)
+        {
+            double k[3];
+            NormalizeD(a + 3, k, 3);
+            double q[4] = { k[0] * sin(a[6] * 0.5), k[1] * sin(a[6] * 0.5), k[2] * sin(a[6] * 0.5), cos(a[6] * 0.5) };
+            RotateD(a, q, r);
+        });
+    RunCase<7, 3>("Rotate(Vector3, Quaternion)", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a + 3, 4); },
+        [](const float* a, float* r) { Out(Rotate(V3(a), Q(a + 3)), r); },
+        [](const double* a, double* r) { RotateD(a, a + 3, r); });
+    RunCase<6, 3>("Reflect(Vector3)", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a + 3, 3); },
+        [](const float* a, float* r) { Out(Reflect(V3(a), V3(a + 3)), r); },
+        [](const double* a, double* r) { double d = DotD(a, a + 3, 3); for (int i = 0; i < 3; i++) r[i] = a[i] - 2.0 * a[3 + i] * d; });
+    RunCase<7, 3>("Refract", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 3); NormalizeInPlace(a + 3, 3); a[6] = 0.5f + 0.25f * (a[6] + 1.0f); },
+        [](const float* a, float* r) { Out(Refract(V3(a), V3(a + 3), a[6]), r); },
+        [](const double* a, double* r)
+        {
+            double dot = DotD(a, a + 3, 3);
+            double d = 1.0 - a[6] * a[6] * (1.0 - dot * dot);
+            for (int i = 0; i < 3; i++) r[i] = (d >= 0.0) ? a[6] * a[i] - (a[6] * dot + sqrt(d)) * a[3 + i] : 0.0;
+        });
+    RunCase<12, 3>("Barycenter", -100.0f, 100.0f,
+        [](float* a) { ReshapeDegenerate(a + 3); },
+        [](const float* a, float* r) { Out(Barycenter(V3(a), V3(a + 3), V3(a + 6), V3(a + 9)), r); },
+        [](const double* a, double* r)
+        {
+            double v0[3], v1[3], v2[3];
+            for (int i = 0; i < 3; i++) v0[i] = a[6 + i] - a[3 + i], v1[i] = a[9 + i] - a[3 + i], v2[i] = a[i] - a[3 + i];
+            double d00 = DotD(v0, v0, 3), d01 = DotD(v0, v1, 3), d11 = DotD(v1, v1, 3);
+            double d20 = DotD(v2, v0, 3), d21 = DotD(v2, v1, 3);
+            double denom = d00 * d11 - d01 * d01;
+            r[1] = (d11 * d20 - d01 * d21) / denom;
+            r[2] = (d00 * d21 - d01 * d20) / denom;
+            r[0] = 1.0 - (r[1] + r[2]);
+        });
+    RunCase<19, 3>("Multiply(Vector3, Matrix)", -1.0f, 1.0f,
+        [](const float* a, float* r) { Out(Multiply(V3(a), M(a + 3)), r); },
+        [](const double* a, double* r) { const double* m = a + 3; for (int i = 0; i < 3; i++) r[i] = m[i] * a[0] + m[4 + i] * a[1] + m[8 + i] * a[2] + m[12 + i]; });
+    RunCase<7, 3>("Lerp(Vector3)", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Lerp(V3(a), V3(a + 3), a[6]), r); },
+        [](const double* a, double* r) { for (int i = 0; i < 3; i++) r[i] = a[i] + a[6] * (a[3 + i] - a[i]); });
+}
+
+static void MatrixCases()
+{
+    RunCase<32, 16>("Multiply(Matrix)", -1.0f, 1.0f,
+        [](const float* a, float* r) { Out(Multiply(M(a), M(a + 16)), r); },
+        [](const double* a, double* r) { MultiplyD(a, a + 16, r); });
+    RunCase<16, 16>("Transpose", -1.0f, 1.0f,
+        [](const float* a, float* r) { Out(Transpose(M(a)), r); },
+        [](const double* a, double* r) { for (int i = 0; i < 4; i++) for (int j = 0; j < 4; j++) r[4 * i + j] = a[4 * j + i]; });
+    RunCase<16, 1>("Determinant", -1.0f, 1.0f,
+        [](float* a) { a[0] += 4.0f; a[5] += 4.0f; a[10] += 4.0f; a[15] += 4.0f; },
+        [](const float* a, float* r) { r[0] = Determinant(M(a)); },
+        [](const double* a, double* r) { double inv[16]; r[0] = InvertD(a, inv); });
+    RunCase<16, 16>("Invert(Matrix)", -1.0f, 1.0f,
+        [](float* a) { a[0] += 4.0f; a[5] += 4.0f; a[10] += 4.0f; a[15] += 4.0f; },
+        [](const float* a, float* r) { Out(Invert(M(a)), r); },
+        [](const double* a, double* r) { InvertD(a, r); });
+    RunCase<1, 16>("RotateX", -PI, PI,
+        [](const float* a, float* r) { Out(RotateX(a[0]), r); },
+        [](const double* a, double* r) { RotationD(1.0, 0.0, 0.0, a[0], r); });
+    RunCase<1, 16>("RotateY", -PI, PI,
+        [](const float* a, float* r) { Out(RotateY(a[0]), r); },
+        [](const double* a, double* r) { RotationD(0.0, 1.0, 0.0, a[0], r); });
+    RunCase<1, 16>("RotateZ", -PI, PI,
+        [](const float* a, float* r) { Out(RotateZ(a[0]), r); },
+        [](const double* a, double* r) { RotationD(0.0, 0.0, 1.0, a[0], r); });
+    RunCase<4, 16>("Rotate(axis, angle)", -PI, PI,
+        [](const float* a, float* r) { Out(Rotate(V3(a), a[3]), r); },
+        [](const double* a, double* r) { double k[3]; NormalizeD(a, k, 3); RotationD(k[0], k[1], k[2], a[3], r); });
+    RunCase<6, 16>("Ortho", -100.0f, 100.0f,
+        [](const float* a, float* r) { Out(Ortho(a[0], a[1], a[2], a[3], a[4], a[5]), r); },
+        [](const double* a, double* r)
+        {
+            double rl = a[1] - a[0], tb = a[3] - a[2], fn = a[5] - a[4];
+            double m[16] = { 2.0 / rl, 0, 0, 0, 0, 2.0 / tb, 0, 0, 0, 0, -2.0 / fn, 0,
+                -(a[0] + a[1]) / rl, -(a[3] + a[2]) / tb, -(a[5] + a[4]) / fn, 1.0 };
+            for (int k = 0; k < 16; k++) r[k] = m[k];
+        });
+    RunCase<4, 16>("Perspective", 0.0f, 1.0f,
+        [](float* a) { a[0] = 0.1f + 2.5f * a[0]; a[1] = 0.5f + 1.5f * a[1]; a[2] = 0.1f + a[2]; a[3] = 10.0f + 990.0f * a[3]; },
+        [](const float* a, float* r) { Out(Perspective(a[0], a[1], a[2], a[3]), r); },
+        [](const double* a, double* r)
+        {
+            double top = a[2] * tan(a[0] * 0.5), right = top * a[1], fn = a[3] - a[2];
+            double m[16] = { a[2] / right, 0, 0, 0, 0, a[2] / top, 0, 0, 0, 0, -(a[3] + a[2]) / fn, -1.0,
+                0, 0, -(a[3] * a[2] * 2.0) / fn, 0 };
+            for (int k = 0; k < 16; k++) r[k] = m[k];
+        });
+}
+
+static void QuaternionCases()
+{
+    RunCase<4, 4>("Normalize(Quaternion)", -1.0f, 1.0f,
+        [](const float* a, float* r) { Out(Normalize(Q(a)), r); },
+        [](const double* a, double* r) { NormalizeD(a, r, 4); });
+    RunCase<8, 4>("Multiply(Quaternion)", -1.0f, 1.0f,
+        [](const float* a, float* r) { Out(Multiply(Q(a), Q(a + 4)), r); },
+        [](const double* a, double* r)
+        {
+            const double* p = a;
+            const double* q = a + 4;
+            r[0] = p[0] * q[3] + p[3] * q[0] + p[1] * q[2] - p[2] * q[1];
+            r[1] = p[1] * q[3] + p[3] * q[1] + p[2] * q[0] - p[0] * q[2];
+            r[2] = p[2] * q[3] + p[3] * q[2] + p[0] * q[1] - p[1] * q[0];
+            r[3] = p[3] * q[3] - p[0] * q[0] - p[1] * q[1] - p[2] * q[2];
+        });
+    RunCase<4, 4>("Invert(Quaternion)", -1.0f, 1.0f,
+        [](const float* a, float* r) { Out(Invert(Q(a)), r); },
+        [](const double* a, double* r) { double l = DotD(a, a, 4); r[0] = -a[0] / l; r[1] = -a[1] / l; r[2] = -a[2] / l; r[3] = a[3] / l; });
+    RunCase<4, 4>("FromAxisAngle", -PI, PI,
+        [](const float* a, float* r) { Out(FromAxisAngle(V3(a), a[3]), r); },
+        [](const double* a, double* r) { double k[3]; NormalizeD(a, k, 3); for (int i = 0; i < 3; i++) r[i] = k[i] * sin(a[3] * 0.5); r[3] = cos(a[3] * 0.5); });
+    RunCase<4, 16>("ToMatrix", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 4); },
+        [](const float* a, float* r) { Out(ToMatrix(Q(a)), r); },
+        [](const double* a, double* r)
+        {
+            // Columns are the images of the basis vectors
+            for (int c = 0; c < 3; c++)
+            {
+                double e[3] = { c == 0 ? 1.0 : 0.0, c == 1 ? 1.0 : 0.0, c == 2 ? 1.0 : 0.0 };
+                RotateD(e, a, r + 4 * c);
+                r[4 * c + 3] = 0.0;
+            }
+            r[12] = r[13] = r[14] = 0.0;
+            r[15] = 1.0;
+        });
+    RunCase<3, 4>("FromEuler", -PI, PI,
+        [](const float* a, float* r) { Out(FromEuler(a[0], a[1], a[2]), r); },
+        [](const double* a, double* r)
+        {
+            double x0 = cos(a[0] * 0.5), x1 = sin(a[0] * 0.5);
+            double y0 = cos(a[1] * 0.5), y1 = sin(a[1] * 0.5);
+            double z0 = cos(a[2] * 0.5), z1 = sin(a[2] * 0.5);
+            r[0] = x1 * y0 * z0 - x0 * y1 * z1;
+            r[1] = x0 * y1 * z0 + x1 * y0 * z1;
+            r[2] = x0 * y0 * z1 - x1 * y1 * z0;
+            r[3] = x0 * y0 * z0 + x1 * y1 * z1;
+        });
+    RunCase<9, 4>("Nlerp", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 4); NormalizeInPlace(a + 4, 4); a[8] = 0.5f * (a[8] + 1.0f); },
+        [](const float* a, float* r) { Out(Nlerp(Q(a), Q(a + 4), a[8]), r); },
+        [](const double* a, double* r) { double l[4]; for (int i = 0; i < 4; i++) l[i] = a[i] + a[8] * (a[4 + i] - a[i]); NormalizeD(l, r, 4); });
+    RunCase<9, 4>("Slerp", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 4); NormalizeInPlace(a + 4, 4); a[8] = 0.5f * (a[8] + 1.0f); },
+        [](const float* a, float* r) { Out(Slerp(Q(a), Q(a + 4), a[8]), r); },
+        [](const double* a, double* r)
+        {
+            double q2[4] = { a[4], a[5], a[6], a[7] };
+            double c = DotD(a, q2, 4);
+            if (c < 0.0) { for (int i = 0; i < 4; i++) q2[i] = -q2[i]; c = -c; }
+            double theta = acos(fmin(1.0, c));
+            double s = sin(theta);
+            double ra = (s > 1e-12) ? sin((1.0 - a[8]) * theta) / s : 1.0 - a[8];
+            double rb = (s > 1e-12) ? sin(a[8] * theta) / s : a[8];
+            for (int i = 0; i < 4; i++) r[i] = a[i] * ra + q2[i] * rb;
+        });
+    RunCase<6, 4>("FromTo", -1.0f, 1.0f,
+        [](float* a) { NormalizeInPlace(a, 3); NormalizeInPlace(a + 3, 3); },
+        [](const float* a, float* r) { Out(FromTo(V3(a), V3(a + 3)), r); },
+        [](const double* a, double* r) { double q[4]; CrossD(a, a + 3, q); q[3] = 1.0 + DotD(a, a + 3, 3); NormalizeD(q, r, 4); });
+}
+
+//----------------------------------------------------------------------------------
+// Entry point, registered in Bench.cpp as "math"
+//----------------------------------------------------------------------------------
+void BenchMath()
+{
+    mathResults.clear();
+
+    ScalarCases();
+    Vector2Cases();
+    FastTrigCases();
+    FixedCases();
+    Vector3Cases();
+    MatrixCases();
+    QuaternionCases();
+
+    printf("math: %d cases x %d samples (max ulp / max rel / max abs / ns per call)\n", (int)mathResults.size(), MATH_BENCH_SAMPLES);
+    for (const MathCaseResult& r : mathResults)
+    {
+        printf("  %-34s %12.4g %10.3g %10.3g %8.2f", r.name, r.maxUlp, r.maxRelError, r.maxAbsError, r.nsPerCall);
+        if (r.nanMismatches > 0) printf("  (%d NaN mismatches)", r.nanMismatches);
+        printf("\n");
+    }
+
+    WriteReport("math_report.json");
+}
@@ -0,0 +1,235 @@
+#include "Particles.h"
+#include <cfloat>
+#include <cmath>
+
+//----------------------------------------------------------------------------------
+// Helpers
+//----------------------------------------------------------------------------------
+
+// Uniform in [min, max)
+static float RandomRange(uint32_t& state, float min, float max)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    return min + (max - min) * ((state >> 8) * (1.0f / 16777216.0f));
+}
+
+// Move the last live particle into slot index
+static void RemoveParticle(ParticlePool& pool, int index)
+{
+    int last = --pool.count;
+    pool.x[index] = pool.x[last];
+    pool.y[index] = pool.y[last];
+    pool.vx[index] = pool.vx[last];
+    pool.vy[index] = pool.vy[last];
+    pool.life[index] = pool.life[last];
+    pool.fade[index] = pool.fade[last];
+    pool.size[index] = pool.size[last];
+    pool.color[index] = pool.color[last];
+}
+
+static Color ParticleColor(const ParticlePool& pool, int index)
+{
+    Color color = pool.color[index];
+    float alpha = pool.life[index] * pool.fade[index];
+    color.a = (unsigned char)(color.a * (alpha < 1.0f ? alpha : 1.0f));
+
+    return color;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+ParticlePool LoadParticlePool(int capacity, float drag, uint32_t seed)
+{
+    ParticlePool result = {};
+    result.capacity = capacity;
+    result.drag = drag;
+    result.random = (seed != 0) ? seed : 1;
+
+    result.x = new float[capacity];
+    result.y = new float[capacity];
+    result.vx = new float[capacity];
+    result.vy = new float[capacity];
+    result.life = new float[capacity];
+    result.fade = new float[capacity];
+    result.size = new float[capacity];
+    result.color = new Color[capacity];
+
+    return result;
+}
+
+void UnloadParticlePool(ParticlePool& pool)
+{
+    delete[] pool.x;
+    delete[] pool.y;
+    delete[] pool.vx;
+    delete[] pool.vy;
+    delete[] pool.life;
+    delete[] pool.fade;
+    delete[] pool.size;
+    delete[] pool.color;
+    pool = {};
+}
+
+int EmitParticles(ParticlePool& pool, const ParticleBurst& burst)
+{
+    int count = burst.count;
+    if (count > pool.capacity - pool.count)
+    {
+        pool.dropped += count - (pool.capacity - pool.count);
+        count = pool.capacity - pool.count;
+    }
+
+    for (int i = pool.count; i < pool.count + count; i++)
+    {
+        float angle = RandomRange(pool.random, 0.0f, 2.0f * PI);
+        float speed = RandomRange(pool.random, burst.speedMin, burst.speedMax);
+        float life = RandomRange(pool.random, burst.lifeMin, burst.lifeMax);
+
+        pool.x[i] = burst.position.x;
+        pool.y[i] = burst.position.y;
+        pool.vx[i] = burst.velocity.x + cosf(angle) * speed;
+        pool.vy[i] = burst.velocity.y + sinf(angle) * speed;
+        pool.life[i] = life;
+        pool.fade[i] = 1.0f / life;
+        pool.size[i] = burst.size;
+        pool.color[i] = burst.color;
+    }
+
+    pool.count += count;
+    pool.emitted += count;
+
+    return count;
+}
+
+void UpdateParticles(ParticlePool& pool, float dt)
+{
+    float keep = powf(pool.drag, dt);
+    int dead = 0;
+    int i = 0;
+
+#if defined(PARTICLES_SSE2)
+    __m128 delta = _mm_set1_ps(dt);
+    __m128 scale = _mm_set1_ps(keep);
+    __m128 zero = _mm_setzero_ps();
+
+    for (; i + 4 <= pool.count; i += 4)
+    {
+        __m128 vx = _mm_mul_ps(_mm_loadu_ps(pool.vx + i), scale);
+        __m128 vy = _mm_mul_ps(_mm_loadu_ps(pool.vy + i), scale);
+        __m128 life = _mm_sub_ps(_mm_loadu_ps(pool.life + i), delta);
+
+        _mm_storeu_ps(pool.vx + i, vx);
+        _mm_storeu_ps(pool.vy + i, vy);
+        _mm_storeu_ps(pool.x + i, _mm_add_ps(_mm_loadu_ps(pool.x + i), _mm_mul_ps(vx, delta)));
+        _mm_storeu_ps(pool.y + i, _mm_add_ps(_mm_loadu_ps(pool.y + i), _mm_mul_ps(vy, delta)));
+        _mm_storeu_ps(pool.life + i, life);
+        dead |= _mm_movemask_ps(_mm_cmple_ps(life, zero));
+    }
+#endif
+
+    // Same operation order as the SSE2 path
+    for (; i < pool.count; i++)
+    {
+        pool.vx[i] *= keep;
+        pool.vy[i] *= keep;
+        pool.x[i] += pool.vx[i] * dt;
+        pool.y[i] += pool.vy[i] * dt;
+        pool.life[i] -= dt;
+        dead |= (pool.life[i] <= 0.0f);
+    }
+
+    if (dead == 0) return;
+
+    // Remove the dead, a moved-in particle is checked again
+    for (i = 0; i < pool.count; )
+    {
+#if defined(PARTICLES_SSE2)
+        if (i + 4 <= pool.count && _mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(pool.life + i), zero)) == 0)
+        {
+            i += 4;
+            continue;
+        }
+#endif
+        if (pool.life[i] <= 0.0f) RemoveParticle(pool, i);
+        else i++;
+    }
+}
+
+Rectangle ParticleBounds(const ParticlePool& pool)
+{
+    if (pool.count == 0) return { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    float xMin = FLT_MAX, yMin = FLT_MAX;
+    float xMax = -FLT_MAX, yMax = -FLT_MAX;
+    float sizeMax = 0.0f;
+    int i = 0;
+
+#if defined(PARTICLES_SSE2)
+    __m128 xMin4 = _mm_set1_ps(FLT_MAX), yMin4 = _mm_set1_ps(FLT_MAX);
+    __m128 xMax4 = _mm_set1_ps(-FLT_MAX), yMax4 = _mm_set1_ps(-FLT_MAX);
+    __m128 sizeMax4 = _mm_setzero_ps();
+
+    for (; i + 4 <= pool.count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(pool.x + i);
+        __m128 y = _mm_loadu_ps(pool.y + i);
+        xMin4 = _mm_min_ps(xMin4, x);
+        xMax4 = _mm_max_ps(xMax4, x);
+        yMin4 = _mm_min_ps(yMin4, y);
+        yMax4 = _mm_max_ps(yMax4, y);
+        sizeMax4 = _mm_max_ps(sizeMax4, _mm_loadu_ps(pool.size + i));
+    }
+
+    float lanes[5][4];
+    _mm_storeu_ps(lanes[0], xMin4);
+    _mm_storeu_ps(lanes[1], xMax4);
+    _mm_storeu_ps(lanes[2], yMin4);
+    _mm_storeu_ps(lanes[3], yMax4);
+    _mm_storeu_ps(lanes[4], sizeMax4);
+    for (int lane = 0; lane < 4; lane++)
+    {
+        xMin = fminf(xMin, lanes[0][lane]);
+        xMax = fmaxf(xMax, lanes[1][lane]);
+        yMin = fminf(yMin, lanes[2][lane]);
+        yMax = fmaxf(yMax, lanes[3][lane]);
+        sizeMax = fmaxf(sizeMax, lanes[4][lane]);
+    }
+#endif
+
+    for (; i < pool.count; i++)
+    {
+        xMin = fminf(xMin, pool.x[i]);
+        xMax = fmaxf(xMax, pool.x[i]);
+        yMin = fminf(yMin, pool.y[i]);
+        yMax = fmaxf(yMax, pool.y[i]);
+        sizeMax = fmaxf(sizeMax, pool.size[i]);
+    }
+
+    // Centers to the outer edges of the largest square
+    float half = sizeMax * 0.5f;
+
+    return { xMin - half, yMin - half, xMax - xMin + sizeMax, yMax - yMin + sizeMax };
+}
+
+void AddParticles(RectBatch& batch, const ParticlePool& pool)
+{
+    for (int i = 0; i < pool.count; i++)
+    {
+        float half = pool.size[i] * 0.5f;
+        AddRect(batch, pool.x[i] - half, pool.y[i] - half, pool.x[i] + half, pool.y[i] + half, ParticleColor(pool, i));
+    }
+}
+
+void DrawParticles(SoftCanvas& canvas, const ParticlePool& pool)
+{
+    for (int i = 0; i < pool.count; i++)
+    {
+        float half = pool.size[i] * 0.5f;
+        SoftDrawRectangleRec(canvas, { pool.x[i] - half, pool.y[i] - half, pool.size[i], pool.size[i] }, ParticleColor(pool, i));
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "raylib.h"
+#include "RectBatch.h"
+#include "SoftRender.h"
+#include <cstdint>
+
+// Fixed-capacity particle pool for ball trails and hit sparks.
+// Particles are stored as a structure of arrays (x, y, vx, vy, life, ... each in an array of
+// its own), so the update streams through a few tight float arrays. Live particles stay packed
+// at the front: a burst is written after the last one and a dead particle is replaced by the
+// last one, so nothing is allocated after LoadParticlePool. A burst that doesn't fit is cut.
+// UpdateParticles handles 4 particles per iteration with SSE2 when the compiler targets it
+// (always on x64), scalar otherwise. Each particle is a square that fades out over its life;
+// AddParticles puts all of them into one RectBatch draw.
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PARTICLES_SSE2
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Particles emitted together, each with a random direction, speed and life in the given ranges
+typedef struct ParticleBurst {
+    int count;
+    Vector2 position;
+    Vector2 velocity;       // Shared by the whole burst, the random part is added to it
+    float speedMin;
+    float speedMax;
+    float lifeMin;          // Seconds
+    float lifeMax;
+    float size;             // Square side in pixels
+    Color color;            // Alpha fades from this to 0 over the life
+} ParticleBurst;
+
+typedef struct ParticlePool {
+    int capacity;
+    int count;              // Live particles, at indices [0, count)
+
+    float* x;
+    float* y;
+    float* vx;              // Pixels per second
+    float* vy;
+    float* life;            // Seconds left
+    float* fade;            // 1 / lifetime, alpha scale is life * fade
+    float* size;
+    Color* color;
+
+    float drag;             // Share of the velocity kept after one second
+    uint32_t random;        // Emission random state (xorshift)
+
+    // Stats
+    long long emitted;
+    long long dropped;      // Particles cut from bursts on a full pool
+} ParticlePool;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+ParticlePool LoadParticlePool(int capacity, float drag, uint32_t seed);
+void UnloadParticlePool(ParticlePool& pool);
+
+int EmitParticles(ParticlePool& pool, const ParticleBurst& burst);     // Particles emitted
+void UpdateParticles(ParticlePool& pool, float dt);                    // Move, slow down, age and remove dead ones
+Rectangle ParticleBounds(const ParticlePool& pool);                    // Area every particle lies in, empty without particles
+
+void AddParticles(RectBatch& batch, const ParticlePool& pool);         // Like AddRect, draws when the batch fills up
+void DrawParticles(SoftCanvas& canvas, const ParticlePool& pool);
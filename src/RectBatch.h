@@ -0,0 +1,91 @@
+#pragma once
+#include "raylib.h"
+#include "Math.h"
+#include <cstring>
+
+// Axis-aligned rectangles collected into one vertex buffer and drawn with a single DrawMesh.
+// Each rectangle is two triangles (6 vertices, no index buffer, so no 65535 vertex limit).
+// The CPU arrays of the mesh are the staging buffer, they are refilled every frame and
+// uploaded with UpdateMeshBuffer before the draw.
+// NOTE: DrawRectBatch draws right away, while raylib's own shapes and text stay queued until
+// EndDrawing, so batched rectangles end up underneath them.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct RectBatch {
+    Mesh mesh;              // vertices and colors hold capacity * 6 vertices
+    Material material;      // Default material (vertex colors, white texture)
+    int capacity;           // Max rectangles per draw, a full batch is drawn and restarted
+    int count;              // Rectangles added since the last draw
+} RectBatch;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Create batch for up to capacity rectangles per draw
+// NOTE: Needs a GL context (call after InitWindow)
+inline RectBatch LoadRectBatch(int capacity)
+{
+    RectBatch result = {};
+    result.capacity = capacity;
+    result.mesh.vertexCount = capacity * 6;
+    result.mesh.triangleCount = capacity * 2;
+    result.mesh.vertices = (float*)MemAlloc(capacity * 6 * 3 * sizeof(float));
+    result.mesh.colors = (unsigned char*)MemAlloc(capacity * 6 * 4);
+    UploadMesh(&result.mesh, true);
+    result.material = LoadMaterialDefault();
+
+    return result;
+}
+
+inline void UnloadRectBatch(RectBatch& batch)
+{
+    UnloadMesh(batch.mesh);     // Also frees the CPU arrays
+    UnloadMaterial(batch.material);
+    batch = {};
+}
+
+// Upload and draw the rectangles added so far, then empty the batch
+inline void DrawRectBatch(RectBatch& batch)
+{
+    if (batch.count == 0) return;
+
+    // Only the used part of the buffers is uploaded and drawn
+    Mesh mesh = batch.mesh;
+    mesh.vertexCount = batch.count * 6;
+    mesh.triangleCount = batch.count * 2;
+    UpdateMeshBuffer(mesh, 0, mesh.vertices, mesh.vertexCount * 3 * sizeof(float), 0);
+    UpdateMeshBuffer(mesh, 3, mesh.colors, mesh.vertexCount * 4, 0);
+    DrawMesh(mesh, batch.material, MatrixIdentity());
+
+    batch.count = 0;
+}
+
+// Add rectangle from its edges
+inline void AddRect(RectBatch& batch, float xMin, float yMin, float xMax, float yMax, Color color)
+{
+    if (batch.count == batch.capacity) DrawRectBatch(batch);
+
+    // Same winding as DrawRectanglePro, so back-face culling keeps it
+    float* v = batch.mesh.vertices + batch.count * 6 * 3;
+    v[0] = xMin; v[1] = yMin; v[2] = 0.0f;
+    v[3] = xMin; v[4] = yMax; v[5] = 0.0f;
+    v[6] = xMax; v[7] = yMin; v[8] = 0.0f;
+    v[9] = xMax; v[10] = yMin; v[11] = 0.0f;
+    v[12] = xMin; v[13] = yMax; v[14] = 0.0f;
+    v[15] = xMax; v[16] = yMax; v[17] = 0.0f;
+
+    // Color is 4 bytes RGBA, same as the vertex color layout
+    unsigned char* c = batch.mesh.colors + batch.count * 6 * 4;
+    for (int i = 0; i < 6; i++) memcpy(c + i * 4, &color, 4);
+
+    batch.count++;
+}
+
+// Add rectangle, same arguments as DrawRectangleRec
+inline void AddRect(RectBatch& batch, Rectangle rec, Color color)
+{
+    AddRect(batch, rec.x, rec.y, rec.x + rec.width, rec.y + rec.height, color);
+}
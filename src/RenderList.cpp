@@ -0,0 +1,203 @@
+#include "RenderList.h"
+#include "DirtyRects.h"
+#include <cstdio>
+
+//----------------------------------------------------------------------------------
+// raylib backend
+//----------------------------------------------------------------------------------
+
+// Cached text for a command, nullptr when every slot is taken by other formats
+static HudText* FindText(RaylibRenderer* renderer, const RenderCommand& command, bool add)
+{
+    int fontSize = (int)command.rec.height;
+    for (int i = 0; i < renderer->textCount; i++)
+    {
+        HudText& text = renderer->texts[i];
+        if (text.format == command.format && text.fontSize == fontSize && ColorToInt(text.color) == ColorToInt(command.color))
+            return &text;
+    }
+
+    if (!add || renderer->textCount == sizeof(renderer->texts) / sizeof(renderer->texts[0])) return nullptr;
+
+    HudText& text = renderer->texts[renderer->textCount++];
+    text = LoadHudText(command.format, fontSize, command.color);
+
+    return &text;
+}
+
+static void PrepareRaylib(void* context, const RenderList& list)
+{
+    RaylibRenderer* renderer = (RaylibRenderer*)context;
+
+    for (int i = 0; i < list.count; i++)
+    {
+        const RenderCommand& command = list.commands[i];
+        if (command.type != RENDER_TEXT) continue;
+
+        HudText* text = FindText(renderer, command, true);
+        if (text != nullptr) UpdateHudText(*text, command.value);
+    }
+}
+
+static void RenderRaylib(void* context, const RenderList& list)
+{
+    RaylibRenderer* renderer = (RaylibRenderer*)context;
+
+    for (int i = 0; i < list.count; i++)
+    {
+        const RenderCommand& command = list.commands[i];
+        switch (command.type)
+        {
+            case RENDER_CLEAR: ClearBackground(command.color); break;
+            case RENDER_RECT: AddRect(renderer->rects, command.rec, command.color); break;
+            case RENDER_PARTICLES: AddParticles(renderer->rects, *command.particles); break;
+            case RENDER_TEXT:
+            {
+                HudText* text = FindText(renderer, command, false);
+                if (text != nullptr && text->valid && text->value == command.value) DrawHudText(*text, (int)command.rec.x, (int)command.rec.y);
+                else DrawText(TextFormat(command.format, command.value), (int)command.rec.x, (int)command.rec.y, (int)command.rec.height, command.color);
+            } break;
+            default: break;
+        }
+    }
+
+    // Rectangles go out in one draw; raylib's queued text still lands on top at EndDrawing
+    DrawRectBatch(renderer->rects);
+}
+
+RaylibRenderer LoadRaylibRenderer(int rectCapacity)
+{
+    RaylibRenderer result = {};
+    result.rects = LoadRectBatch(rectCapacity);
+
+    return result;
+}
+
+void UnloadRaylibRenderer(RaylibRenderer& renderer)
+{
+    for (int i = 0; i < renderer.textCount; i++) UnloadHudText(renderer.texts[i]);
+    UnloadRectBatch(renderer.rects);
+    renderer = {};
+}
+
+RenderBackend RaylibBackend(RaylibRenderer* renderer)
+{
+    RenderBackend result = {};
+    result.name = "raylib";
+    result.context = renderer;
+    result.prepare = PrepareRaylib;
+    result.render = RenderRaylib;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Software backend
+//----------------------------------------------------------------------------------
+
+static void DrawSoftwareCommand(SoftCanvas& canvas, const RenderCommand& command)
+{
+    switch (command.type)
+    {
+        case RENDER_CLEAR: SoftClearBackground(canvas, command.color); break;
+        case RENDER_RECT: SoftDrawRectangleRec(canvas, command.rec, command.color); break;
+        case RENDER_PARTICLES: DrawParticles(canvas, *command.particles); break;
+        case RENDER_TEXT:
+        {
+            char text[128];
+            snprintf(text, sizeof(text), command.format, command.value);
+            SoftDrawText(canvas, text, (int)command.rec.x, (int)command.rec.y, (int)command.rec.height, command.color);
+        } break;
+        default: break;
+    }
+}
+
+static void RenderSoftware(void* context, const RenderList& list)
+{
+    SoftCanvas& canvas = *(SoftCanvas*)context;
+
+    for (int i = 0; i < list.count; i++) DrawSoftwareCommand(canvas, list.commands[i]);
+}
+
+RenderBackend SoftwareBackend(SoftCanvas* canvas)
+{
+    RenderBackend result = {};
+    result.name = "software";
+    result.context = canvas;
+    result.render = RenderSoftware;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Software backend, dirty rectangles
+//----------------------------------------------------------------------------------
+
+static void RenderSoftwareDirty(void* context, const RenderList& list)
+{
+    DirtyRenderer* renderer = (DirtyRenderer*)context;
+    SoftCanvas& canvas = *renderer->canvas;
+
+    DirtyRegion region = {};
+    if (renderer->drawnTo == canvas.pixels) region = DiffRenderLists(renderer->previous, list, SoftMeasureText, canvas.width, canvas.height, renderer->fullRatio);
+    else region.full = true;
+
+    if (region.full)
+    {
+        RenderSoftware(&canvas, list);
+        renderer->fullFrames++;
+    }
+    else
+    {
+        // Same commands, limited to each dirty rectangle in turn
+        for (int r = 0; r < region.count; r++)
+        {
+            Rectangle dirty = region.rects[r];
+            SoftBeginScissorMode(canvas, (int)dirty.x, (int)dirty.y, (int)dirty.width, (int)dirty.height);
+
+            for (int i = 0; i < list.count; i++)
+            {
+                const RenderCommand& command = list.commands[i];
+                if (command.type == RENDER_CLEAR || CheckCollisionRecs(dirty, RenderCommandBounds(command, SoftMeasureText, canvas.width, canvas.height)))
+                    DrawSoftwareCommand(canvas, command);
+            }
+        }
+        SoftEndScissorMode(canvas);
+    }
+
+    renderer->frames++;
+    renderer->pixels += (long long)DirtyArea(region, canvas.width, canvas.height);
+    renderer->previous = list;
+    renderer->drawnTo = canvas.pixels;
+}
+
+RenderBackend SoftwareDirtyBackend(DirtyRenderer* renderer)
+{
+    RenderBackend result = {};
+    result.name = "software (dirty rectangles)";
+    result.context = renderer;
+    result.render = RenderSoftwareDirty;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Null backend
+//----------------------------------------------------------------------------------
+
+static void RenderNull(void* context, const RenderList& list)
+{
+    NullRenderer* renderer = (NullRenderer*)context;
+    renderer->frames++;
+    renderer->commands += list.count;
+}
+
+RenderBackend NullBackend(NullRenderer* renderer)
+{
+    RenderBackend result = {};
+    result.name = "null";
+    result.context = renderer;
+    result.render = RenderNull;
+
+    return result;
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include "raylib.h"
+#include "HudText.h"
+#include "Particles.h"
+#include "RectBatch.h"
+#include "SoftRender.h"
+
+// Frame recorded as a list of draw commands (clear, rectangle, text), drawn afterwards by
+// a backend: raylib (OpenGL), the software rasterizer or a null sink that draws nothing.
+// The list is a fixed array of plain structs: recording never allocates, and a frame can
+// be copied, compared or replayed on another backend.
+// Text is stored as a format and one integer, so a backend can cache the rendered string.
+// Particles are stored as a pointer to the pool, which must not change until the list is drawn.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int RENDER_LIST_CAPACITY = 64;
+
+typedef enum {
+    RENDER_CLEAR = 0,
+    RENDER_RECT,
+    RENDER_TEXT,
+    RENDER_PARTICLES
+} RenderCommandType;
+
+typedef struct RenderCommand {
+    RenderCommandType type;
+    Color color;
+    Rectangle rec;          // RENDER_RECT area, RENDER_TEXT top-left in x, y and font size in height, RENDER_PARTICLES bounds
+    const char* format;     // RENDER_TEXT printf format with at most one %i (string literal, must outlive the list)
+    int value;              // RENDER_TEXT value for format, RENDER_PARTICLES particle count
+    const ParticlePool* particles;  // RENDER_PARTICLES
+} RenderCommand;
+
+typedef struct RenderList {
+    RenderCommand commands[RENDER_LIST_CAPACITY];
+    int count;
+    int dropped;            // Commands past capacity, not recorded
+} RenderList;
+
+// Consumer of render lists. prepare runs before the frame begins (raylib renders cached
+// text into textures there), render draws the list into the current frame.
+typedef struct RenderBackend {
+    const char* name;
+    void* context;
+    void (*prepare)(void* context, const RenderList& list);     // Optional
+    void (*render)(void* context, const RenderList& list);
+} RenderBackend;
+
+// raylib backend state, needs a GL context
+typedef struct RaylibRenderer {
+    RectBatch rects;        // Every RENDER_RECT and particle of a frame, drawn in one call
+    HudText texts[8];       // Rendered text per format, added on first use
+    int textCount;
+} RaylibRenderer;
+
+// Software backend that repaints only what changed since the previous frame (see DirtyRects.h)
+typedef struct DirtyRenderer {
+    SoftCanvas* canvas;
+    float fullRatio;            // Repaint everything when more than this share of the screen changed
+    RenderList previous;        // Last frame drawn
+    const uint32_t* drawnTo;    // Pixels previous went into, any other buffer gets a full repaint
+    int frames;
+    int fullFrames;
+    long long pixels;           // Pixels repainted
+} DirtyRenderer;
+
+// Null backend, counts what it was given
+typedef struct NullRenderer {
+    int frames;
+    long long commands;
+} NullRenderer;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Recording
+//----------------------------------------------------------------------------------
+
+inline void ClearRenderList(RenderList& list)
+{
+    list.count = 0;
+    list.dropped = 0;
+}
+
+inline RenderCommand* PushCommand(RenderList& list, RenderCommandType type, Color color)
+{
+    if (list.count == RENDER_LIST_CAPACITY)
+    {
+        list.dropped++;
+        return nullptr;
+    }
+
+    RenderCommand* command = &list.commands[list.count++];
+    command->type = type;
+    command->color = color;
+    command->rec = {};
+    command->format = nullptr;
+    command->value = 0;
+    command->particles = nullptr;
+
+    return command;
+}
+
+inline void PushClear(RenderList& list, Color color)
+{
+    PushCommand(list, RENDER_CLEAR, color);
+}
+
+inline void PushRect(RenderList& list, Rectangle rec, Color color)
+{
+    RenderCommand* command = PushCommand(list, RENDER_RECT, color);
+    if (command != nullptr) command->rec = rec;
+}
+
+// Same placement as DrawText(TextFormat(format, value), x, y, fontSize, color)
+inline void PushText(RenderList& list, const char* format, int value, int x, int y, int fontSize, Color color)
+{
+    RenderCommand* command = PushCommand(list, RENDER_TEXT, color);
+    if (command == nullptr) return;
+
+    command->rec = { (float)x, (float)y, 0.0f, (float)fontSize };
+    command->format = format;
+    command->value = value;
+}
+
+// Every live particle of the pool, bounds and count are taken now
+inline void PushParticles(RenderList& list, const ParticlePool& pool)
+{
+    RenderCommand* command = PushCommand(list, RENDER_PARTICLES, WHITE);
+    if (command == nullptr) return;
+
+    command->rec = ParticleBounds(pool);
+    command->value = pool.count;
+    command->particles = &pool;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration - Backends
+//----------------------------------------------------------------------------------
+RaylibRenderer LoadRaylibRenderer(int rectCapacity);    // Call after InitWindow
+void UnloadRaylibRenderer(RaylibRenderer& renderer);
+
+RenderBackend RaylibBackend(RaylibRenderer* renderer);  // Draws inside BeginDrawing/EndDrawing
+RenderBackend SoftwareBackend(SoftCanvas* canvas);
+RenderBackend SoftwareDirtyBackend(DirtyRenderer* renderer);   // Set canvas and fullRatio first
+RenderBackend NullBackend(NullRenderer* renderer);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Submission
+//----------------------------------------------------------------------------------
+
+// Before the frame begins (outside BeginDrawing)
+inline void PrepareRenderList(const RenderBackend& backend, const RenderList& list)
+{
+    if (backend.prepare != nullptr) backend.prepare(backend.context, list);
+}
+
+inline void DrawRenderList(const RenderBackend& backend, const RenderList& list)
+{
+    backend.render(backend.context, list);
+}
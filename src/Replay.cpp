@@ -0,0 +1,110 @@
+#include "Replay.h"
+#include <cstdio>
+#include <cstring>
+
+// File layout: header, then tickCount key bytes, then keyframeCount GameStates (native byte order)
+static const char REPLAY_MAGIC[8] = { 'P', 'O', 'N', 'G', 'R', 'P', 'L', '1' };
+
+typedef struct ReplayHeader {
+    char magic[8];
+    int tickRate;
+    int keyframeInterval;
+    int tickCount;
+    int keyframeCount;
+    int stateSize;              // sizeof(GameState) of the build that recorded it
+} ReplayHeader;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+Replay LoadReplayRecorder(int tickRate, int keyframeInterval, int maxTicks)
+{
+    Replay result = {};
+    result.tickRate = tickRate;
+    result.keyframeInterval = keyframeInterval;
+    result.tickCapacity = maxTicks;
+    result.keys = new unsigned char[maxTicks];
+    result.keyframes = new GameState[maxTicks / keyframeInterval + 1];
+
+    return result;
+}
+
+void RecordReplayTick(Replay& replay, const GameState& state, unsigned int keys)
+{
+    if (replay.tickCount == replay.tickCapacity) return;
+
+    if (replay.tickCount % replay.keyframeInterval == 0) replay.keyframes[replay.keyframeCount++] = state;
+    replay.keys[replay.tickCount++] = (unsigned char)keys;
+}
+
+bool SaveReplay(const Replay& replay, const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+    if (file == nullptr) return false;
+
+    ReplayHeader header = {};
+    memcpy(header.magic, REPLAY_MAGIC, sizeof(header.magic));
+    header.tickRate = replay.tickRate;
+    header.keyframeInterval = replay.keyframeInterval;
+    header.tickCount = replay.tickCount;
+    header.keyframeCount = replay.keyframeCount;
+    header.stateSize = (int)sizeof(GameState);
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        fwrite(replay.keys, 1, replay.tickCount, file) == (size_t)replay.tickCount &&
+        fwrite(replay.keyframes, sizeof(GameState), replay.keyframeCount, file) == (size_t)replay.keyframeCount;
+    fclose(file);
+
+    return written;
+}
+
+Replay LoadReplay(const char* fileName)
+{
+    Replay result = {};
+    FILE* file = fopen(fileName, "rb");
+    if (file == nullptr) return result;
+
+    ReplayHeader header = {};
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, REPLAY_MAGIC, sizeof(header.magic)) == 0 &&
+        header.stateSize == (int)sizeof(GameState) && header.tickRate > 0 && header.keyframeInterval > 0 && header.tickCount > 0 &&
+        header.keyframeCount == (header.tickCount - 1) / header.keyframeInterval + 1;
+
+    if (valid)
+    {
+        result = LoadReplayRecorder(header.tickRate, header.keyframeInterval, header.tickCount);
+        result.tickCount = header.tickCount;
+        result.keyframeCount = header.keyframeCount;
+        valid = fread(result.keys, 1, result.tickCount, file) == (size_t)result.tickCount &&
+            fread(result.keyframes, sizeof(GameState), result.keyframeCount, file) == (size_t)result.keyframeCount;
+        if (!valid) UnloadReplay(result);
+    }
+    fclose(file);
+
+    return result;
+}
+
+void UnloadReplay(Replay& replay)
+{
+    delete[] replay.keys;
+    delete[] replay.keyframes;
+    replay = {};
+}
+
+GameState ReplayState(const Replay& replay, int tick)
+{
+    int keyframe = tick / replay.keyframeInterval;
+    if (keyframe >= replay.keyframeCount) keyframe = replay.keyframeCount - 1;
+    if (tick > replay.tickCount) tick = replay.tickCount;
+
+    GameState state = replay.keyframes[keyframe];
+    float dt = 1.0f / replay.tickRate;
+    for (int t = keyframe * replay.keyframeInterval; t < tick; t++) StepGame(state, replay.keys[t], dt);
+
+    return state;
+}
+
+bool ReplayKeyframeMatches(const Replay& replay, int keyframe, const GameState& state)
+{
+    return keyframe < replay.keyframeCount && memcmp(&replay.keyframes[keyframe], &state, sizeof(GameState)) == 0;
+}
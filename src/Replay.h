@@ -0,0 +1,39 @@
+#pragma once
+#include "raylib.h"
+#include "Game.h"
+
+// Match recording: the keys held on every tick plus a keyframe (the whole GameState) every
+// keyframeInterval ticks. StepGame is deterministic for a given build, so stepping a keyframe
+// with the recorded keys reproduces the match, and a player can start at any keyframe
+// instead of the first tick (seeking, exporting segments in parallel).
+// The recorder is allocated up front for maxTicks; ticks past that are not recorded.
+// NOTE: Replays only play back on builds that step the game identically (same code, compiler
+// and floating-point settings); ReplayKeyframeMatches tells when they don't.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct Replay {
+    int tickRate;               // Ticks per second the game was stepped at (dt = 1 / tickRate)
+    int keyframeInterval;       // Ticks between keyframes
+
+    unsigned char* keys;        // GameKey flags per tick
+    int tickCount;
+    int tickCapacity;
+
+    GameState* keyframes;       // keyframes[k] is the state before tick k * keyframeInterval
+    int keyframeCount;
+} Replay;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+Replay LoadReplayRecorder(int tickRate, int keyframeInterval, int maxTicks);
+void RecordReplayTick(Replay& replay, const GameState& state, unsigned int keys);  // State before the tick, keys it is stepped with
+
+bool SaveReplay(const Replay& replay, const char* fileName);
+Replay LoadReplay(const char* fileName);       // tickCount 0 when the file is missing or invalid
+void UnloadReplay(Replay& replay);
+
+GameState ReplayState(const Replay& replay, int tick);             // State before tick, stepped from the keyframe before it
+bool ReplayKeyframeMatches(const Replay& replay, int keyframe, const GameState& state);     // Same bytes as the recorded keyframe
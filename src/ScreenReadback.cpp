@@ -0,0 +1,155 @@
+#include "ScreenReadback.h"
+#include <cstddef>
+#include <cstring>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <GL/gl.h>                  // OpenGL 1.1, the rest is loaded below
+
+#define READBACK_PIXEL_PACK_BUFFER  0x88EB
+#define READBACK_STREAM_READ        0x88E1
+#define READBACK_READ_ONLY          0x88B8
+
+typedef void (APIENTRY* GenBuffersProc)(GLsizei count, GLuint* buffers);
+typedef void (APIENTRY* DeleteBuffersProc)(GLsizei count, const GLuint* buffers);
+typedef void (APIENTRY* BindBufferProc)(GLenum target, GLuint buffer);
+typedef void (APIENTRY* BufferDataProc)(GLenum target, ptrdiff_t size, const void* data, GLenum usage);
+typedef void* (APIENTRY* MapBufferProc)(GLenum target, GLenum access);
+typedef GLboolean (APIENTRY* UnmapBufferProc)(GLenum target);
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct ScreenReadback
+{
+    int width;
+    int height;
+    GLuint buffers[SCREEN_READBACK_DEPTH];
+    int next;                       // Buffer the next frame is read into
+    int queued;
+
+    GenBuffersProc genBuffers;
+    DeleteBuffersProc deleteBuffers;
+    BindBufferProc bindBuffer;
+    BufferDataProc bufferData;
+    MapBufferProc mapBuffer;
+    UnmapBufferProc unmapBuffer;
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+ScreenReadback* LoadScreenReadback(int width, int height)
+{
+    ScreenReadback* readback = new ScreenReadback();
+    readback->width = width;
+    readback->height = height;
+    readback->genBuffers = (GenBuffersProc)wglGetProcAddress("glGenBuffers");
+    readback->deleteBuffers = (DeleteBuffersProc)wglGetProcAddress("glDeleteBuffers");
+    readback->bindBuffer = (BindBufferProc)wglGetProcAddress("glBindBuffer");
+    readback->bufferData = (BufferDataProc)wglGetProcAddress("glBufferData");
+    readback->mapBuffer = (MapBufferProc)wglGetProcAddress("glMapBuffer");
+    readback->unmapBuffer = (UnmapBufferProc)wglGetProcAddress("glUnmapBuffer");
+    if (readback->genBuffers == nullptr || readback->deleteBuffers == nullptr || readback->bindBuffer == nullptr ||
+        readback->bufferData == nullptr || readback->mapBuffer == nullptr || readback->unmapBuffer == nullptr)
+    {
+        delete readback;            // No OpenGL 2.1 context
+        return nullptr;
+    }
+
+    readback->genBuffers(SCREEN_READBACK_DEPTH, readback->buffers);
+    for (GLuint buffer : readback->buffers)
+    {
+        readback->bindBuffer(READBACK_PIXEL_PACK_BUFFER, buffer);
+        readback->bufferData(READBACK_PIXEL_PACK_BUFFER, (ptrdiff_t)width * height * 4, nullptr, READBACK_STREAM_READ);
+    }
+    readback->bindBuffer(READBACK_PIXEL_PACK_BUFFER, 0);
+
+    return readback;
+}
+
+void UnloadScreenReadback(ScreenReadback* readback)
+{
+    if (readback == nullptr) return;
+
+    readback->deleteBuffers(SCREEN_READBACK_DEPTH, readback->buffers);
+    delete readback;
+}
+
+void QueueScreenReadback(ScreenReadback* readback)
+{
+    if (readback->queued == SCREEN_READBACK_DEPTH) return;
+
+    // With a pack buffer bound glReadPixels only schedules the copy, the pointer is an offset into it
+    readback->bindBuffer(READBACK_PIXEL_PACK_BUFFER, readback->buffers[readback->next]);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, readback->width, readback->height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    readback->bindBuffer(READBACK_PIXEL_PACK_BUFFER, 0);
+
+    readback->next = (readback->next + 1) % SCREEN_READBACK_DEPTH;
+    readback->queued++;
+}
+
+int GetScreenReadbackQueued(const ScreenReadback* readback)
+{
+    return readback->queued;
+}
+
+bool TakeScreenReadback(ScreenReadback* readback, void* pixels)
+{
+    if (readback->queued == 0) return false;
+
+    int oldest = (readback->next - readback->queued + SCREEN_READBACK_DEPTH) % SCREEN_READBACK_DEPTH;
+    readback->queued--;
+    if (pixels == nullptr) return true;
+
+    readback->bindBuffer(READBACK_PIXEL_PACK_BUFFER, readback->buffers[oldest]);
+    const unsigned char* frame = (const unsigned char*)readback->mapBuffer(READBACK_PIXEL_PACK_BUFFER, READBACK_READ_ONLY);
+    if (frame != nullptr)
+    {
+        // GL rows go bottom up
+        size_t stride = (size_t)readback->width * 4;
+        for (int y = 0; y < readback->height; y++)
+            memcpy((unsigned char*)pixels + (size_t)y * stride, frame + (size_t)(readback->height - 1 - y) * stride, stride);
+        readback->unmapBuffer(READBACK_PIXEL_PACK_BUFFER);
+    }
+    readback->bindBuffer(READBACK_PIXEL_PACK_BUFFER, 0);
+
+    return frame != nullptr;
+}
+
+#else
+
+struct ScreenReadback
+{
+    int queued;
+};
+
+ScreenReadback* LoadScreenReadback(int width, int height)
+{
+    return nullptr;
+}
+
+void UnloadScreenReadback(ScreenReadback* readback)
+{
+    delete readback;
+}
+
+void QueueScreenReadback(ScreenReadback* readback)
+{
+}
+
+int GetScreenReadbackQueued(const ScreenReadback* readback)
+{
+    return readback->queued;
+}
+
+bool TakeScreenReadback(ScreenReadback* readback, void* pixels)
+{
+    return false;
+}
+
+#endif
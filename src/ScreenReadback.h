@@ -0,0 +1,27 @@
+#pragma once
+
+// Asynchronous reads of the OpenGL back buffer through a ring of pixel buffer objects (PBOs).
+// QueueScreenReadback starts the copy of the finished frame on the GPU and returns at once;
+// the frame is taken SCREEN_READBACK_DEPTH - 1 frames later, when the GPU is long done with
+// it, and copied upright straight into memory of the caller's. Nothing is allocated after
+// LoadScreenReadback.
+// NOTE: Windows OpenGL only (buffer functions come from wglGetProcAddress), elsewhere
+// LoadScreenReadback returns nullptr. No raylib.h here, the Windows headers it clashes with
+// are needed in ScreenReadback.cpp.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int SCREEN_READBACK_DEPTH = 3;
+
+typedef struct ScreenReadback ScreenReadback;   // Owns the pixel buffers
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+ScreenReadback* LoadScreenReadback(int width, int height);     // Needs the GL context, nullptr without pixel buffer objects
+void UnloadScreenReadback(ScreenReadback* readback);            // Needs the GL context, drops queued frames
+
+void QueueScreenReadback(ScreenReadback* readback);             // Start reading the back buffer, ring must not be full
+int GetScreenReadbackQueued(const ScreenReadback* readback);    // Frames queued, SCREEN_READBACK_DEPTH when one is due
+bool TakeScreenReadback(ScreenReadback* readback, void* pixels);    // Oldest frame into width * height RGBA pixels (nullptr drops it), false if none
@@ -0,0 +1,94 @@
+#pragma once
+#include "Math.h"
+#include <cstdint>
+
+// Seeded serve directions without cosf/sinf.
+// A serve is a unit vector at a uniform angle in [0, 60] degrees, pointing left or right
+// with equal chance (same distribution as ResetBall's Rotate(Random(0, 60) * DEG2RAD)).
+// Each serve hashes a counter into 32 bits: 1 bit picks the side, 24 bits pick the angle.
+// The angle's top 6 bits index a 64-entry constexpr table and the remaining 18 bits rotate
+// by a small offset (< 0.94 degrees) using a short polynomial, which is exact to float
+// precision at that size. The generator is counter based, so bulk serves have no loop
+// carried dependency and any world can be reseeded or skipped ahead.
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define SERVE_ANGLE_MAX (60.0f * DEG2RAD)
+#define SERVE_TABLE_SIZE 64
+#define SERVE_TABLE_STEP (SERVE_ANGLE_MAX / SERVE_TABLE_SIZE)
+#define SERVE_FINE_BITS 18
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Serve generator state, one per world
+typedef struct ServeRandom {
+    uint32_t counter;
+} ServeRandom;
+
+static constexpr SinCosTable<SERVE_TABLE_SIZE> SERVE_TABLE = MakeSinCosTable<SERVE_TABLE_SIZE>(0.0f, SERVE_TABLE_STEP);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Create generator, equal seeds give equal serve sequences
+RMAPI ServeRandom SeedServe(uint32_t seed)
+{
+    ServeRandom result = { seed * 0x9E3779B9u };
+
+    return result;
+}
+
+// Mix a counter into 32 well distributed bits
+RMAPI uint32_t ServeHash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+
+    return x;
+}
+
+// Serve direction from 32 random bits
+RMAPI Vector2 ServeDirection(uint32_t bits)
+{
+    int index = (int)((bits >> SERVE_FINE_BITS) & (SERVE_TABLE_SIZE - 1));
+    float side = (bits & 0x80000000u) ? 1.0f : -1.0f;
+
+    // Small rotation inside the table step
+    float d = (float)(bits & ((1u << SERVE_FINE_BITS) - 1)) * (SERVE_TABLE_STEP / (1 << SERVE_FINE_BITS));
+    float d2 = d * d;
+    float cd = 1.0f - d2 * 0.5f;
+    float sd = d - d * d2 * (1.0f / 6.0f);
+
+    float c = SERVE_TABLE.cos[index];
+    float s = SERVE_TABLE.sin[index];
+
+    Vector2 result = { side * (c * cd - s * sd), side * (s * cd + c * sd) };
+
+    return result;
+}
+
+// Next serve direction
+RMAPI Vector2 ServeDirection(ServeRandom& random)
+{
+    return ServeDirection(ServeHash(random.counter++));
+}
+
+// Serve count balls from center
+RMAPI void ServeBalls(ServeRandom& random, Vector2* positions, Vector2* directions, int count, Vector2 center)
+{
+    uint32_t counter = random.counter;
+
+    for (int i = 0; i < count; i++)
+    {
+        positions[i] = center;
+        directions[i] = ServeDirection(ServeHash(counter + (uint32_t)i));
+    }
+
+    random.counter = counter + (uint32_t)count;
+}
@@ -0,0 +1,355 @@
+#include "SoftRender.h"
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SOFT_SSE2
+#endif
+
+//----------------------------------------------------------------------------------
+// Built-in font
+//----------------------------------------------------------------------------------
+// Printable ASCII (32-126). Each glyph is 9 rows of 5 bits (bit 4 = leftmost column):
+// rows 0-6 sit above the baseline, rows 7-8 are descenders. Inside the 10 px cell the
+// glyph starts one row down, like the default font.
+struct SoftGlyph
+{
+    int width;              // Columns used, advance before spacing
+    unsigned char rows[9];
+};
+
+static const SoftGlyph SOFT_FONT[95] = {
+    { 3, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },   // space
+    { 1, { 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00 } },   // !
+    { 3, { 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },   // "
+    { 5, { 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A, 0x00, 0x00 } },   // #
+    { 5, { 0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04, 0x00, 0x00 } },   // $
+    { 5, { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03, 0x00, 0x00 } },   // %
+    { 5, { 0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D, 0x00, 0x00 } },   // &
+    { 1, { 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },   // '
+    { 3, { 0x04, 0x08, 0x10, 0x10, 0x10, 0x08, 0x04, 0x00, 0x00 } },   // (
+    { 3, { 0x10, 0x08, 0x04, 0x04, 0x04, 0x08, 0x10, 0x00, 0x00 } },   // )
+    { 5, { 0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00, 0x00, 0x00 } },   // *
+    { 5, { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00, 0x00, 0x00 } },   // +
+    { 2, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x00 } },   // ,
+    { 5, { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00 } },   // -
+    { 1, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00 } },   // .
+    { 5, { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00 } },   // /
+    { 5, { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E, 0x00, 0x00 } },   // 0
+    { 4, { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00 } },   // 1
+    { 5, { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F, 0x00, 0x00 } },   // 2
+    { 5, { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E, 0x00, 0x00 } },   // 3
+    { 5, { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02, 0x00, 0x00 } },   // 4
+    { 5, { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E, 0x00, 0x00 } },   // 5
+    { 5, { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E, 0x00, 0x00 } },   // 6
+    { 5, { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08, 0x00, 0x00 } },   // 7
+    { 5, { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x00, 0x00 } },   // 8
+    { 5, { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C, 0x00, 0x00 } },   // 9
+    { 1, { 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00 } },   // :
+    { 2, { 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x08, 0x10, 0x00 } },   // ;
+    { 4, { 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00 } },   // <
+    { 5, { 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00 } },   // =
+    { 4, { 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00 } },   // >
+    { 5, { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04, 0x00, 0x00 } },   // ?
+    { 5, { 0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E, 0x00, 0x00 } },   // @
+    { 5, { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11, 0x00, 0x00 } },   // A
+    { 5, { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E, 0x00, 0x00 } },   // B
+    { 5, { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E, 0x00, 0x00 } },   // C
+    { 5, { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C, 0x00, 0x00 } },   // D
+    { 5, { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F, 0x00, 0x00 } },   // E
+    { 5, { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x00, 0x00 } },   // F
+    { 5, { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F, 0x00, 0x00 } },   // G
+    { 5, { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11, 0x00, 0x00 } },   // H
+    { 3, { 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00 } },   // I
+    { 5, { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C, 0x00, 0x00 } },   // J
+    { 5, { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11, 0x00, 0x00 } },   // K
+    { 5, { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x00, 0x00 } },   // L
+    { 5, { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00 } },   // M
+    { 5, { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 } },   // N
+    { 5, { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00 } },   // O
+    { 5, { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10, 0x00, 0x00 } },   // P
+    { 5, { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D, 0x00, 0x00 } },   // Q
+    { 5, { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11, 0x00, 0x00 } },   // R
+    { 5, { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E, 0x00, 0x00 } },   // S
+    { 5, { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 } },   // T
+    { 5, { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00 } },   // U
+    { 5, { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00, 0x00 } },   // V
+    { 5, { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A, 0x00, 0x00 } },   // W
+    { 5, { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11, 0x00, 0x00 } },   // X
+    { 5, { 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x00, 0x00 } },   // Y
+    { 5, { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F, 0x00, 0x00 } },   // Z
+    { 3, { 0x1C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x00, 0x00 } },   // [
+    { 5, { 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00 } },   // backslash
+    { 3, { 0x1C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1C, 0x00, 0x00 } },   // ]
+    { 5, { 0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },   // ^
+    { 5, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00 } },   // _
+    { 2, { 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },   // `
+    { 5, { 0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F, 0x00, 0x00 } },   // a
+    { 5, { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1E, 0x00, 0x00 } },   // b
+    { 5, { 0x00, 0x00, 0x0E, 0x10, 0x10, 0x11, 0x0E, 0x00, 0x00 } },   // c
+    { 5, { 0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0F, 0x00, 0x00 } },   // d
+    { 5, { 0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E, 0x00, 0x00 } },   // e
+    { 5, { 0x06, 0x09, 0x08, 0x1C, 0x08, 0x08, 0x08, 0x00, 0x00 } },   // f
+    { 5, { 0x00, 0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x11, 0x0E } },   // g
+    { 5, { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00, 0x00 } },   // h
+    { 3, { 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00 } },   // i
+    { 4, { 0x02, 0x00, 0x06, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C } },   // j
+    { 4, { 0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12, 0x00, 0x00 } },   // k
+    { 3, { 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00 } },   // l
+    { 5, { 0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11, 0x00, 0x00 } },   // m
+    { 5, { 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00, 0x00 } },   // n
+    { 5, { 0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00 } },   // o
+    { 5, { 0x00, 0x00, 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 } },   // p
+    { 5, { 0x00, 0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x01, 0x01 } },   // q
+    { 5, { 0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10, 0x00, 0x00 } },   // r
+    { 5, { 0x00, 0x00, 0x0F, 0x10, 0x0E, 0x01, 0x1E, 0x00, 0x00 } },   // s
+    { 5, { 0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 } },   // t
+    { 5, { 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0D, 0x00, 0x00 } },   // u
+    { 5, { 0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00, 0x00 } },   // v
+    { 5, { 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A, 0x00, 0x00 } },   // w
+    { 5, { 0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x00, 0x00 } },   // x
+    { 5, { 0x00, 0x00, 0x11, 0x11, 0x11, 0x0F, 0x01, 0x11, 0x0E } },   // y
+    { 5, { 0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F, 0x00, 0x00 } },   // z
+    { 3, { 0x04, 0x08, 0x08, 0x10, 0x08, 0x08, 0x04, 0x00, 0x00 } },   // {
+    { 1, { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 } },   // |
+    { 3, { 0x10, 0x08, 0x08, 0x04, 0x08, 0x08, 0x10, 0x00, 0x00 } },   // }
+    { 5, { 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00 } },   // ~
+};
+
+static const SoftGlyph& GetSoftGlyph(char c)
+{
+    return (c >= 32 && c < 127) ? SOFT_FONT[c - 32] : SOFT_FONT['?' - 32];
+}
+
+//----------------------------------------------------------------------------------
+// Spans
+//----------------------------------------------------------------------------------
+
+// Color as the 32-bit pixel value
+static uint32_t ToPixel(Color color)
+{
+    uint32_t result = 0;
+    memcpy(&result, &color, sizeof(result));
+
+    return result;
+}
+
+// (x + 128 + ((x + 128) >> 8)) >> 8 is x / 255 rounded, exact for x <= 255 * 255
+static uint32_t BlendChannel(uint32_t src, uint32_t dst, uint32_t alpha)
+{
+    uint32_t x = src * alpha + dst * (255 - alpha) + 128;
+
+    return (x + (x >> 8)) >> 8;
+}
+
+// Overwrite count pixels
+static void StoreSpan(uint32_t* dst, size_t count, uint32_t pixel)
+{
+    size_t i = 0;
+
+#if defined(SOFT_SSE2)
+    __m128i fill = _mm_set1_epi32((int)pixel);
+    for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i*)(dst + i), fill);
+#endif
+
+    for (; i < count; i++) dst[i] = pixel;
+}
+
+// Write count pixels, blending when the color is translucent
+static void FillSpan(uint32_t* dst, int count, Color color)
+{
+    if (color.a == 0) return;
+
+    if (color.a == 255)
+    {
+        StoreSpan(dst, count, ToPixel(color));
+        return;
+    }
+
+    int i = 0;
+    uint32_t pixel = ToPixel(color);
+    uint32_t alpha = color.a;
+
+#if defined(SOFT_SSE2)
+    // 16-bit lanes, two pixels per register: src * alpha is the same for every pixel
+    __m128i zero = _mm_setzero_si128();
+    __m128i srcTerm = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)pixel), zero),
+        _mm_set1_epi16((short)alpha)), _mm_set1_epi16(128));
+    __m128i inverse = _mm_set1_epi16((short)(255 - alpha));
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inverse), srcTerm);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inverse), srcTerm);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Color d = { 0 };
+        memcpy(&d, &dst[i], sizeof(d));
+
+        Color result = { (unsigned char)BlendChannel(color.r, d.r, alpha), (unsigned char)BlendChannel(color.g, d.g, alpha),
+            (unsigned char)BlendChannel(color.b, d.b, alpha), (unsigned char)BlendChannel(color.a, d.a, alpha) };
+        dst[i] = ToPixel(result);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+SoftCanvas LoadSoftCanvas(int width, int height)
+{
+    SoftCanvas result = { width, height, new uint32_t[(size_t)width * height]() };
+    SoftEndScissorMode(result);
+
+    return result;
+}
+
+void UnloadSoftCanvas(SoftCanvas& canvas)
+{
+    delete[] canvas.pixels;
+    canvas = {};
+}
+
+void SoftBeginScissorMode(SoftCanvas& canvas, int x, int y, int width, int height)
+{
+    canvas.clipX0 = (x > 0) ? x : 0;
+    canvas.clipY0 = (y > 0) ? y : 0;
+    canvas.clipX1 = (x + width < canvas.width) ? x + width : canvas.width;
+    canvas.clipY1 = (y + height < canvas.height) ? y + height : canvas.height;
+}
+
+void SoftEndScissorMode(SoftCanvas& canvas)
+{
+    canvas.clipX0 = 0;
+    canvas.clipY0 = 0;
+    canvas.clipX1 = canvas.width;
+    canvas.clipY1 = canvas.height;
+}
+
+// Like ClearBackground, overwrites every pixel in the scissor area (alpha included, as glClear does)
+void SoftClearBackground(SoftCanvas& canvas, Color color)
+{
+    uint32_t pixel = ToPixel(color);
+
+    if (canvas.clipX0 == 0 && canvas.clipX1 == canvas.width)
+    {
+        StoreSpan(canvas.pixels + (size_t)canvas.clipY0 * canvas.width, (size_t)canvas.width * (canvas.clipY1 - canvas.clipY0), pixel);
+        return;
+    }
+
+    for (int y = canvas.clipY0; y < canvas.clipY1; y++)
+        StoreSpan(canvas.pixels + (size_t)y * canvas.width + canvas.clipX0, canvas.clipX1 - canvas.clipX0, pixel);
+}
+
+void SoftDrawRectangleRec(SoftCanvas& canvas, Rectangle rec, Color color)
+{
+    // Pixels whose centers fall inside [x, x + width) x [y, y + height)
+    int x0 = (int)ceilf(rec.x - 0.5f);
+    int x1 = (int)ceilf(rec.x + rec.width - 0.5f);
+    int y0 = (int)ceilf(rec.y - 0.5f);
+    int y1 = (int)ceilf(rec.y + rec.height - 0.5f);
+
+    if (x0 < canvas.clipX0) x0 = canvas.clipX0;
+    if (y0 < canvas.clipY0) y0 = canvas.clipY0;
+    if (x1 > canvas.clipX1) x1 = canvas.clipX1;
+    if (y1 > canvas.clipY1) y1 = canvas.clipY1;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int y = y0; y < y1; y++) FillSpan(canvas.pixels + (size_t)y * canvas.width + x0, x1 - x0, color);
+}
+
+void SoftDrawText(SoftCanvas& canvas, const char* text, int x, int y, int fontSize, Color color)
+{
+    // Same size and spacing rules as DrawText
+    if (fontSize < 10) fontSize = 10;
+    float scale = fontSize / 10.0f;
+    float spacing = (float)(fontSize / 10);
+
+    float penX = (float)x;
+    float penY = (float)y;
+
+    for (const char* c = text; *c != '\0'; c++)
+    {
+        if (*c == '\n')
+        {
+            penX = (float)x;
+            penY += fontSize * 1.5f;
+            continue;
+        }
+
+        const SoftGlyph& glyph = GetSoftGlyph(*c);
+
+        // One rectangle per run of set bits in a row
+        for (int row = 0; row < 9; row++)
+        {
+            unsigned int bits = glyph.rows[row];
+            int column = 0;
+            while (bits != 0)
+            {
+                while (!(bits & (0x10u >> column))) column++;
+                int start = column;
+                while (column < 5 && (bits & (0x10u >> column)))
+                {
+                    bits &= ~(0x10u >> column);
+                    column++;
+                }
+
+                Rectangle run = { penX + start * scale, penY + (row + 1) * scale, (column - start) * scale, scale };
+                SoftDrawRectangleRec(canvas, run, color);
+            }
+        }
+
+        penX += glyph.width * scale + spacing;
+    }
+}
+
+// Width of the widest line, same metrics as SoftDrawText
+int SoftMeasureText(const char* text, int fontSize)
+{
+    if (fontSize < 10) fontSize = 10;
+    float scale = fontSize / 10.0f;
+    float spacing = (float)(fontSize / 10);
+
+    float width = 0.0f;
+    float maxWidth = 0.0f;
+    int glyphs = 0;
+
+    for (const char* c = text; ; c++)
+    {
+        if (*c == '\n' || *c == '\0')
+        {
+            if (glyphs > 0) width -= spacing;
+            if (width > maxWidth) maxWidth = width;
+            if (*c == '\0') break;
+
+            width = 0.0f;
+            glyphs = 0;
+            continue;
+        }
+
+        width += GetSoftGlyph(*c).width * scale + spacing;
+        glyphs++;
+    }
+
+    return (int)maxWidth;
+}
+
+Image SoftCanvasImage(const SoftCanvas& canvas)
+{
+    Image result = { canvas.pixels, canvas.width, canvas.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
+    return result;
+}
+
+bool ExportSoftCanvas(const SoftCanvas& canvas, const char* fileName)
+{
+    return ExportImage(SoftCanvasImage(canvas), fileName);
+}
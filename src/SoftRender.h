@@ -0,0 +1,39 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+
+// CPU rasterizer for the calls the game makes between BeginDrawing and EndDrawing,
+// drawing into an in-memory RGBA framebuffer. Needs no window, GPU or GL context.
+// Coverage and blending follow the OpenGL path: a pixel is inside a rectangle when its
+// center is, and translucent colors blend with SRC_ALPHA, ONE_MINUS_SRC_ALPHA.
+// Text uses a built-in 5x7 bitmap font laid out with DrawText's metrics (10 px base size,
+// fontSize / 10 spacing); glyph shapes differ slightly from raylib's default font.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// RGBA8 framebuffer, pixels are stored as Color (r, g, b, a bytes), row after row
+typedef struct SoftCanvas {
+    int width;
+    int height;
+    uint32_t* pixels;
+    int clipX0, clipY0;     // Scissor area, the whole canvas outside scissor mode
+    int clipX1, clipY1;
+} SoftCanvas;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+SoftCanvas LoadSoftCanvas(int width, int height);
+void UnloadSoftCanvas(SoftCanvas& canvas);
+
+void SoftBeginScissorMode(SoftCanvas& canvas, int x, int y, int width, int height);  // Limit drawing (and clearing) to an area
+void SoftEndScissorMode(SoftCanvas& canvas);
+
+void SoftClearBackground(SoftCanvas& canvas, Color color);
+void SoftDrawRectangleRec(SoftCanvas& canvas, Rectangle rec, Color color);
+void SoftDrawText(SoftCanvas& canvas, const char* text, int x, int y, int fontSize, Color color);
+int SoftMeasureText(const char* text, int fontSize);
+
+Image SoftCanvasImage(const SoftCanvas& canvas);                    // Image view of the pixels (no copy, don't unload)
+bool ExportSoftCanvas(const SoftCanvas& canvas, const char* fileName);  // Save as PNG/BMP/... through ExportImage
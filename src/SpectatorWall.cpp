@@ -0,0 +1,294 @@
+#include "SpectatorWall.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+constexpr Color WALL_TILE_COLOR = { 24, 24, 24, 255 };
+constexpr int WALL_HOLD_FRAMES = 180;       // A finished match stays up this long, then restarts
+constexpr int WALL_RECTS_PER_TILE = 4 + 2 * 2 * 5 * 2;     // Tile, ball, paddles, two 2-digit scores of up to 2 runs a row
+
+//----------------------------------------------------------------------------------
+// Block digits
+//----------------------------------------------------------------------------------
+// 3x5 digits, each row is 3 bits (bit 2 = leftmost column)
+static const unsigned char WALL_DIGITS[10][5] = {
+    { 7, 5, 5, 5, 7 }, { 2, 6, 2, 2, 7 }, { 7, 1, 7, 4, 7 }, { 7, 1, 3, 1, 7 }, { 5, 5, 7, 1, 1 },
+    { 7, 4, 7, 1, 7 }, { 7, 4, 7, 5, 7 }, { 7, 1, 1, 1, 1 }, { 7, 5, 7, 5, 7 }, { 7, 5, 7, 1, 7 }
+};
+
+static void AddWallRect(SpectatorWall& wall, float x, float y, float width, float height, Color color)
+{
+    if (wall.rectCount == wall.capacity) return;
+
+    wall.rects[wall.rectCount] = { x, y, width, height };
+    wall.colors[wall.rectCount] = color;
+    wall.rectCount++;
+}
+
+// Width of value in block digits with cell-sized pixels
+static float DigitsWidth(int value, float cell)
+{
+    int digits = (value >= 10) ? 2 : 1;
+
+    return (digits * 4 - 1) * cell;
+}
+
+// Up to two digits, one rectangle per run of set bits in a row
+static void AddDigits(SpectatorWall& wall, int value, float x, float y, float cell, Color color)
+{
+    if (value > 99) value = 99;
+    int digits[2] = { value / 10, value % 10 };
+    int first = (value >= 10) ? 0 : 1;
+
+    for (int d = first; d < 2; d++, x += 4 * cell)
+    {
+        for (int row = 0; row < 5; row++)
+        {
+            unsigned int bits = WALL_DIGITS[digits[d]][row];
+            for (int column = 0; column < 3; column++)
+            {
+                if (!(bits & (4u >> column))) continue;
+
+                int start = column;
+                while (column + 1 < 3 && (bits & (4u >> (column + 1)))) column++;
+                AddWallRect(wall, x + start * cell, y + row * cell, (column - start + 1) * cell, cell, color);
+            }
+        }
+    }
+}
+
+// Arena box to screen
+static Rectangle ToTile(const Rectangle& tile, float scale, Box box)
+{
+    return { tile.x + box.xMin * scale, tile.y + box.yMin * scale, (box.xMax - box.xMin) * scale, (box.yMax - box.yMin) * scale };
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+SpectatorWall LoadSpectatorWall(int count, int width, int height)
+{
+    SpectatorWall result = {};
+    result.count = count;
+
+    // Column count giving the largest tiles
+    for (int columns = 1; columns <= count; columns++)
+    {
+        int rows = (count + columns - 1) / columns;
+        float scale = fminf(width / (columns * SCREEN_WIDTH), height / (rows * SCREEN_HEIGHT));
+        if (scale > result.scale)
+        {
+            result.scale = scale;
+            result.columns = columns;
+            result.rows = rows;
+        }
+    }
+
+    // Grid centered on screen, one pixel between tiles
+    float tileWidth = SCREEN_WIDTH * result.scale;
+    float tileHeight = SCREEN_HEIGHT * result.scale;
+    float left = floorf((width - tileWidth * result.columns) * 0.5f);
+    float top = floorf((height - tileHeight * result.rows) * 0.5f);
+
+    result.tiles = new Rectangle[count];
+    for (int i = 0; i < count; i++)
+    {
+        float x = left + (i % result.columns) * tileWidth;
+        float y = top + (i / result.columns) * tileHeight;
+        result.tiles[i] = { x, y, tileWidth - 1.0f, tileHeight - 1.0f };
+    }
+
+    result.capacity = count * WALL_RECTS_PER_TILE;
+    result.rects = new Rectangle[result.capacity];
+    result.colors = new Color[result.capacity];
+
+    return result;
+}
+
+void UnloadSpectatorWall(SpectatorWall& wall)
+{
+    delete[] wall.tiles;
+    delete[] wall.rects;
+    delete[] wall.colors;
+    wall = {};
+}
+
+bool SpectatorWallText(const SpectatorWall& wall)
+{
+    return 20.0f * wall.scale >= 10.0f;
+}
+
+void RecordSpectatorWall(SpectatorWall& wall, const GameState* matches)
+{
+    bool text = SpectatorWallText(wall);
+    float cell = fmaxf(1.0f, floorf(wall.tiles[0].height / 40.0f));
+    wall.rectCount = 0;
+
+    for (int i = 0; i < wall.count; i++)
+    {
+        const Rectangle& tile = wall.tiles[i];
+        const GameState& match = matches[i];
+
+        AddWallRect(wall, tile.x, tile.y, tile.width, tile.height, WALL_TILE_COLOR);
+        Rectangle ball = ToTile(tile, wall.scale, BallBox(match.ballPosition));
+        AddWallRect(wall, ball.x, ball.y, ball.width, ball.height, WHITE);
+        Rectangle paddle1 = ToTile(tile, wall.scale, PaddleBox(match.paddle1Position));
+        AddWallRect(wall, paddle1.x, paddle1.y, paddle1.width, paddle1.height, WHITE);
+        Rectangle paddle2 = ToTile(tile, wall.scale, PaddleBox(match.paddle2Position));
+        AddWallRect(wall, paddle2.x, paddle2.y, paddle2.width, paddle2.height, WHITE);
+
+        if (!text)
+        {
+            // Winner's score turns green
+            Color color1 = (match.winner == 1) ? LIME : GRAY;
+            Color color2 = (match.winner == 2) ? LIME : GRAY;
+            AddDigits(wall, match.player1Points, tile.x + 2 * cell, tile.y + 2 * cell, cell, color1);
+            AddDigits(wall, match.player2Points, tile.x + tile.width - 2 * cell - DigitsWidth(match.player2Points, cell), tile.y + 2 * cell, cell, color2);
+        }
+    }
+}
+
+void DrawSpectatorWall(const SpectatorWall& wall, const GameState* matches, SoftCanvas& canvas)
+{
+    for (int i = 0; i < wall.rectCount; i++) SoftDrawRectangleRec(canvas, wall.rects[i], wall.colors[i]);
+
+    if (!SpectatorWallText(wall)) return;
+
+    int fontSize = (int)(20.0f * wall.scale);
+    int volleySize = (int)(50.0f * wall.scale);
+    char text[64];
+    for (int i = 0; i < wall.count; i++)
+    {
+        const Rectangle& tile = wall.tiles[i];
+        snprintf(text, sizeof(text), "Player One: %i", matches[i].player1Points);
+        SoftDrawText(canvas, text, (int)(tile.x + 20.0f * wall.scale), (int)(tile.y + 10.0f * wall.scale), fontSize, (matches[i].winner == 1) ? LIME : GRAY);
+        snprintf(text, sizeof(text), "Player Two: %i", matches[i].player2Points);
+        SoftDrawText(canvas, text, (int)(tile.x + 1050.0f * wall.scale), (int)(tile.y + 10.0f * wall.scale), fontSize, (matches[i].winner == 2) ? LIME : GRAY);
+
+        if (ShowVolley(matches[i]))
+        {
+            snprintf(text, sizeof(text), "%i Volleys!", matches[i].volley);
+            SoftDrawText(canvas, text, (int)(tile.x + 500.0f * wall.scale), (int)(tile.y + 200.0f * wall.scale), volleySize, SKYBLUE);
+        }
+    }
+}
+
+void DrawSpectatorWall(const SpectatorWall& wall, const GameState* matches, RectBatch& batch)
+{
+    for (int i = 0; i < wall.rectCount; i++) AddRect(batch, wall.rects[i], wall.colors[i]);
+    DrawRectBatch(batch);
+
+    if (!SpectatorWallText(wall)) return;
+
+    int fontSize = (int)(20.0f * wall.scale);
+    int volleySize = (int)(50.0f * wall.scale);
+    for (int i = 0; i < wall.count; i++)
+    {
+        const Rectangle& tile = wall.tiles[i];
+        DrawText(TextFormat("Player One: %i", matches[i].player1Points), (int)(tile.x + 20.0f * wall.scale), (int)(tile.y + 10.0f * wall.scale),
+            fontSize, (matches[i].winner == 1) ? LIME : GRAY);
+        DrawText(TextFormat("Player Two: %i", matches[i].player2Points), (int)(tile.x + 1050.0f * wall.scale), (int)(tile.y + 10.0f * wall.scale),
+            fontSize, (matches[i].winner == 2) ? LIME : GRAY);
+
+        if (ShowVolley(matches[i]))
+            DrawText(TextFormat("%i Volleys!", matches[i].volley), (int)(tile.x + 500.0f * wall.scale), (int)(tile.y + 200.0f * wall.scale), volleySize, SKYBLUE);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Spectator mode
+//----------------------------------------------------------------------------------
+
+int RunSpectatorWall(int matches, int frames, const char* fileName)
+{
+    typedef std::chrono::steady_clock Clock;
+    const float dt = 1.0f / 60.0f;
+    bool software = frames > 0;
+    if (matches < 1)
+    {
+        printf("wall: needs at least one match: --wall <matches> [frames [out.png]]\n");
+        return 1;
+    }
+
+    GameState* states = new GameState[matches];
+    int* held = new int[matches];                   // Frames since the match finished
+    uint32_t seed = 1;
+    for (int i = 0; i < matches; i++)
+    {
+        states[i] = InitGame(seed++);
+        held[i] = 0;
+    }
+
+    SoftCanvas canvas = {};
+    RectBatch batch = {};
+    if (software) canvas = LoadSoftCanvas((int)SCREEN_WIDTH, (int)SCREEN_HEIGHT);
+    else
+    {
+        InitWindow((int)SCREEN_WIDTH, (int)SCREEN_HEIGHT, "Pong - Spectator wall");
+        SetTargetFPS(60);
+    }
+
+    SpectatorWall wall = LoadSpectatorWall(matches, (int)SCREEN_WIDTH, (int)SCREEN_HEIGHT);
+    if (!software) batch = LoadRectBatch(wall.capacity);     // Room for every rect the wall can record: one draw
+
+    double stepMs = 0.0;
+    double drawMs = 0.0;
+    double worstMs = 0.0;
+    int frame = 0;
+    for (; software ? frame < frames : !WindowShouldClose(); frame++)
+    {
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < matches; i++)
+        {
+            if (states[i].winner != 0 && ++held[i] > WALL_HOLD_FRAMES)
+            {
+                states[i] = InitGame(seed++);
+                held[i] = 0;
+            }
+            StepGame(states[i], AutoKeys(states[i]), dt);
+        }
+        Clock::time_point stepped = Clock::now();
+
+        RecordSpectatorWall(wall, states);
+        if (software)
+        {
+            SoftClearBackground(canvas, BLACK);
+            DrawSpectatorWall(wall, states, canvas);
+        }
+        else
+        {
+            BeginDrawing();
+            ClearBackground(BLACK);
+            DrawSpectatorWall(wall, states, batch);
+            EndDrawing();
+        }
+
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - stepped).count();
+        stepMs += std::chrono::duration<double, std::milli>(stepped - start).count();
+        drawMs += ms;
+        if (ms > worstMs) worstMs = ms;
+    }
+
+    printf("wall: %d matches in %dx%d tiles of %.0fx%.0f px (%s), %d frames\n", matches, wall.columns, wall.rows, wall.tiles[0].width + 1.0f,
+        wall.tiles[0].height + 1.0f, SpectatorWallText(wall) ? "text" : "block digits", frame);
+    printf("  %.3f ms step, %.3f ms draw per frame (%.3f ms worst), %d rects in one batch\n", stepMs / (frame > 0 ? frame : 1),
+        drawMs / (frame > 0 ? frame : 1), worstMs, wall.rectCount);
+
+    if (software)
+    {
+        if (fileName != nullptr) ExportSoftCanvas(canvas, fileName);
+        UnloadSoftCanvas(canvas);
+    }
+    else
+    {
+        UnloadRectBatch(batch);
+        CloseWindow();
+    }
+
+    UnloadSpectatorWall(wall);
+    delete[] states;
+    delete[] held;
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "raylib.h"
+#include "Game.h"
+#include "RectBatch.h"
+#include "SoftRender.h"
+
+// Every match of a tournament on one screen, each arena scaled down into a tile of a grid.
+// All boxes of all tiles (tile background, ball, paddles, block digits) are collected into
+// one rectangle array per frame and drawn in a single pass, or a single RectBatch draw.
+// Scores use the HUD text while the scaled font is at least DrawText's 10 px minimum;
+// smaller tiles show 3x5 block digits made of rectangles instead, and no volley text.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct SpectatorWall {
+    int count;              // Matches shown
+    int columns;
+    int rows;
+    float scale;            // Tile size relative to the arena
+    Rectangle* tiles;       // Screen area of each arena
+    Rectangle* rects;       // Boxes of the current frame
+    Color* colors;
+    int rectCount;
+    int capacity;
+} SpectatorWall;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+SpectatorWall LoadSpectatorWall(int count, int width, int height);     // Grid with the largest tiles that fit
+void UnloadSpectatorWall(SpectatorWall& wall);
+
+void RecordSpectatorWall(SpectatorWall& wall, const GameState* matches);   // Refill the boxes, count matches
+bool SpectatorWallText(const SpectatorWall& wall);                          // Tiles big enough for HUD text
+
+void DrawSpectatorWall(const SpectatorWall& wall, const GameState* matches, SoftCanvas& canvas);
+void DrawSpectatorWall(const SpectatorWall& wall, const GameState* matches, RectBatch& batch);     // Inside BeginDrawing
+
+// Computer players on every match; frames > 0 renders that many frames in software and
+// saves the last one to fileName (if not null), frames 0 opens a window
+int RunSpectatorWall(int matches, int frames, const char* fileName);
@@ -0,0 +1,45 @@
+#include "TermConsole.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <io.h>
+
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004     // Older SDKs, Windows 10 consoles support it
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+TerminalConsole EnableTerminalConsole(FILE* out)
+{
+    TerminalConsole result = {};
+#if defined(_WIN32)
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(out));
+    DWORD mode = 0;
+    if (handle == INVALID_HANDLE_VALUE || !GetConsoleMode(handle, &mode)) return result;    // Not a console
+
+    result.handle = handle;
+    result.mode = mode;
+    result.codePage = GetConsoleOutputCP();
+    SetConsoleMode(handle, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    return result;
+}
+
+void RestoreTerminalConsole(TerminalConsole& console)
+{
+#if defined(_WIN32)
+    if (console.handle == nullptr) return;
+
+    SetConsoleMode((HANDLE)console.handle, console.mode);
+    SetConsoleOutputCP(console.codePage);
+#endif
+    console = {};
+}
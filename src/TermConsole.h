@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdio>
+
+// Console setup for the terminal renderer. The Windows console only interprets ANSI escape
+// sequences with virtual terminal processing on, and only prints the UTF-8 half blocks as
+// such with the UTF-8 output code page, so both are switched on while the renderer draws and
+// set back to what they were afterwards. Output that isn't a console (redirected to a file or
+// pipe) is left alone. Terminals elsewhere need nothing, the functions do nothing there.
+// NOTE: No raylib.h here, the Windows headers it clashes with are needed in TermConsole.cpp.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct TerminalConsole {
+    void* handle;                   // Console changed, nullptr when nothing was
+    unsigned int mode;              // Previous console mode
+    unsigned int codePage;          // Previous output code page
+} TerminalConsole;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+TerminalConsole EnableTerminalConsole(FILE* out);           // Escape sequences and UTF-8 on, returns what to restore
+void RestoreTerminalConsole(TerminalConsole& console);      // Previous mode and code page back
@@ -0,0 +1,228 @@
+#include "TermRender.h"
+#include <cmath>
+#include <cstring>
+
+constexpr int TERM_CELL_BYTES = 64;     // Worst case for one cell: cursor move, two colors, glyph
+
+//----------------------------------------------------------------------------------
+// Rasterizing
+//----------------------------------------------------------------------------------
+
+static bool SameColor(Color a, Color b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+static bool SameCell(const TermCell& a, const TermCell& b)
+{
+    if (a.glyph != b.glyph) return false;
+
+    // Cells of one color show only the background
+    if (a.glyph == 0 && SameColor(a.top, a.bottom) && SameColor(b.top, b.bottom)) return SameColor(a.bottom, b.bottom);
+
+    return SameColor(a.top, b.top) && SameColor(a.bottom, b.bottom);
+}
+
+static void FillPixels(TerminalRenderer& renderer, Rectangle rec, Color color)
+{
+    // Terminal pixels whose centers fall inside the rectangle, like SoftDrawRectangleRec
+    float size = renderer.pixelSize;
+    int x0 = (int)ceilf(rec.x / size - 0.5f);
+    int x1 = (int)ceilf((rec.x + rec.width) / size - 0.5f);
+    int y0 = (int)ceilf(rec.y / size - 0.5f);
+    int y1 = (int)ceilf((rec.y + rec.height) / size - 0.5f);
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > renderer.columns) x1 = renderer.columns;
+    if (y1 > renderer.rows * 2) y1 = renderer.rows * 2;
+
+    for (int y = y0; y < y1; y++)
+    {
+        for (int x = x0; x < x1; x++)
+        {
+            renderer.pixels[y * renderer.columns + x] = color;
+            renderer.cells[(y / 2) * renderer.columns + x].glyph = 0;     // Shapes cover text drawn before them
+        }
+    }
+}
+
+static void PutText(TerminalRenderer& renderer, const char* text, float x, float y, Color color)
+{
+    int column = (int)floorf(x / renderer.pixelSize + 0.5f);
+    int row = (int)floorf(y / (2.0f * renderer.pixelSize) + 0.5f);
+    if (row < 0 || row >= renderer.rows) return;
+
+    for (const char* c = text; *c != '\0' && column < renderer.columns; c++, column++)
+    {
+        if (column < 0) continue;
+
+        TermCell& cell = renderer.cells[row * renderer.columns + column];
+        cell.glyph = (*c >= 32 && *c < 127) ? *c : '?';
+        cell.top = color;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Output
+//----------------------------------------------------------------------------------
+
+static void Append(TerminalRenderer& renderer, const char* text, int length)
+{
+    memcpy(renderer.buffer + renderer.length, text, length);
+    renderer.length += length;
+}
+
+static void AppendColor(TerminalRenderer& renderer, int layer, Color color)
+{
+    char sequence[24];
+    int length = snprintf(sequence, sizeof(sequence), "\x1b[%d;2;%d;%d;%dm", layer, color.r, color.g, color.b);
+    Append(renderer, sequence, length);
+}
+
+static void RenderTerminal(void* context, const RenderList& list)
+{
+    TerminalRenderer& renderer = *(TerminalRenderer*)context;
+    int cellCount = renderer.columns * renderer.rows;
+
+    for (int i = 0; i < list.count; i++)
+    {
+        const RenderCommand& command = list.commands[i];
+        switch (command.type)
+        {
+            case RENDER_CLEAR:
+            {
+                for (int p = 0; p < cellCount * 2; p++) renderer.pixels[p] = command.color;
+                for (int c = 0; c < cellCount; c++) renderer.cells[c].glyph = 0;
+            } break;
+            case RENDER_RECT: FillPixels(renderer, command.rec, command.color); break;
+            case RENDER_TEXT:
+            {
+                char text[128];
+                snprintf(text, sizeof(text), command.format, command.value);
+                PutText(renderer, text, command.rec.x, command.rec.y, command.color);
+            } break;
+            default: break;
+        }
+    }
+
+    // Cells from the pixel pairs, text keeps its color and takes the background below it
+    for (int row = 0; row < renderer.rows; row++)
+    {
+        for (int column = 0; column < renderer.columns; column++)
+        {
+            TermCell& cell = renderer.cells[row * renderer.columns + column];
+            Color top = renderer.pixels[(row * 2) * renderer.columns + column];
+            Color bottom = renderer.pixels[(row * 2 + 1) * renderer.columns + column];
+            if (cell.glyph == 0) cell.top = top;
+            cell.bottom = (cell.glyph == 0) ? bottom : top;
+        }
+    }
+
+    renderer.length = 0;
+    if (!renderer.started) Append(renderer, "\x1b[0m\x1b[2J\x1b[?25l", 14);
+
+    // Changed cells only; the cursor and colors carry over between neighbouring cells
+    int cursorRow = -1;
+    int cursorColumn = -1;
+    Color foreground = { 0 };
+    Color background = { 0 };
+    bool foregroundSet = false;
+    bool backgroundSet = false;
+
+    for (int row = 0; row < renderer.rows; row++)
+    {
+        for (int column = 0; column < renderer.columns; column++)
+        {
+            int index = row * renderer.columns + column;
+            const TermCell& cell = renderer.cells[index];
+            if (renderer.started && SameCell(cell, renderer.shown[index])) continue;
+
+            if (row != cursorRow || column != cursorColumn)
+            {
+                char move[16];
+                int length = snprintf(move, sizeof(move), "\x1b[%d;%dH", row + 1, column + 1);
+                Append(renderer, move, length);
+            }
+
+            // A cell of one color is a space, it only needs the background
+            bool solid = cell.glyph == 0 && SameColor(cell.top, cell.bottom);
+            if (!backgroundSet || !SameColor(background, cell.bottom))
+            {
+                AppendColor(renderer, 48, cell.bottom);
+                background = cell.bottom;
+                backgroundSet = true;
+            }
+            if (!solid && (!foregroundSet || !SameColor(foreground, cell.top)))
+            {
+                AppendColor(renderer, 38, cell.top);
+                foreground = cell.top;
+                foregroundSet = true;
+            }
+
+            if (cell.glyph != 0) Append(renderer, &cell.glyph, 1);
+            else if (solid) Append(renderer, " ", 1);
+            else Append(renderer, "\xe2\x96\x80", 3);     // Upper half block
+
+            renderer.shown[index] = cell;
+            renderer.cellsSent++;
+            cursorRow = row;
+            cursorColumn = column + 1;
+        }
+    }
+
+    renderer.started = true;
+    renderer.frames++;
+    if (renderer.length == 0) return;
+
+    fwrite(renderer.buffer, 1, renderer.length, renderer.out);
+    fflush(renderer.out);
+    renderer.bytesSent += renderer.length;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+TerminalRenderer LoadTerminalRenderer(int columns, int rows, float pixelSize, FILE* out)
+{
+    TerminalRenderer result = {};
+    result.columns = columns;
+    result.rows = rows;
+    result.pixelSize = pixelSize;
+    result.out = out;
+    result.console = EnableTerminalConsole(out);
+    result.pixels = new Color[columns * rows * 2]();
+    result.cells = new TermCell[columns * rows]();
+    result.shown = new TermCell[columns * rows]();
+    result.bufferSize = columns * rows * TERM_CELL_BYTES + TERM_CELL_BYTES;
+    result.buffer = new char[result.bufferSize];
+
+    return result;
+}
+
+void UnloadTerminalRenderer(TerminalRenderer& renderer)
+{
+    if (renderer.started)
+    {
+        fprintf(renderer.out, "\x1b[0m\x1b[%d;1H\x1b[?25h\n", renderer.rows + 1);
+        fflush(renderer.out);
+    }
+    RestoreTerminalConsole(renderer.console);
+
+    delete[] renderer.pixels;
+    delete[] renderer.cells;
+    delete[] renderer.shown;
+    delete[] renderer.buffer;
+    renderer = {};
+}
+
+RenderBackend TerminalBackend(TerminalRenderer* renderer)
+{
+    RenderBackend result = {};
+    result.name = "terminal";
+    result.context = renderer;
+    result.render = RenderTerminal;
+
+    return result;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "raylib.h"
+#include "RenderList.h"
+#include "TermConsole.h"
+#include <cstdio>
+
+// Render list backend drawing into an ANSI terminal (24-bit color, UTF-8).
+// Each cell holds two square pixels, the top one as the foreground of an upper half
+// block and the bottom one as the background; text writes its characters straight into
+// cells. Frames are diffed against what the terminal already shows and only the changed
+// cells are sent, with cursor moves and color changes only where needed, so an unchanged
+// frame costs nothing and a moving ball a few dozen bytes.
+// On Windows the console is switched to escape sequences and UTF-8 while the renderer is
+// loaded (TermConsole.h).
+// NOTE: Translucent colors are drawn opaque, text ignores font size (one cell per character).
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct TermCell {
+    char glyph;             // Text character, 0 for the half block
+    Color top;              // Text color for characters
+    Color bottom;           // Background for characters
+} TermCell;
+
+typedef struct TerminalRenderer {
+    int columns;
+    int rows;
+    float pixelSize;        // Screen pixels per terminal pixel (cell width, half the cell height)
+    FILE* out;
+    TerminalConsole console;        // Windows console state to restore
+
+    Color* pixels;          // columns x rows * 2, current frame
+    TermCell* cells;        // Current frame
+    TermCell* shown;        // What the terminal shows
+    bool started;           // Screen cleared, shown is valid
+    char* buffer;           // Escape sequences of one frame, written at once
+    int bufferSize;
+    int length;
+
+    // Stats
+    int frames;
+    long long cellsSent;
+    long long bytesSent;
+} TerminalRenderer;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+TerminalRenderer LoadTerminalRenderer(int columns, int rows, float pixelSize, FILE* out);
+void UnloadTerminalRenderer(TerminalRenderer& renderer);   // Restores colors, cursor and console
+
+RenderBackend TerminalBackend(TerminalRenderer* renderer);
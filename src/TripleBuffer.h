@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+
+// Lock-free single writer, single reader hand-off of the newest value.
+// The writer fills WriteBuffer and publishes it, the reader takes whatever was published
+// last; neither side ever waits for the other. Of the three slots, one belongs to the
+// writer, one to the reader and the third (middle) is the one being handed over.
+// Values the reader didn't pick up in time are overwritten, not queued.
+// NOTE: The writer gets back an old slot after publishing, it must write a whole value every time.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr unsigned int TRIPLE_BUFFER_INDEX = 3;     // Slot bits of middle
+constexpr unsigned int TRIPLE_BUFFER_FRESH = 4;     // Set in middle when it holds an unread value
+
+template <typename T>
+struct TripleBuffer
+{
+    T slots[3];
+    std::atomic<unsigned int> middle;   // Slot index | TRIPLE_BUFFER_FRESH
+    unsigned int write;                 // Writer's slot, only touched by the writer
+    unsigned int read;                  // Reader's slot, only touched by the reader
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Fill every slot with initial, before either thread starts
+template <typename T>
+inline void InitTripleBuffer(TripleBuffer<T>& buffer, const T& initial)
+{
+    for (T& slot : buffer.slots) slot = initial;
+    buffer.write = 0;
+    buffer.middle.store(1, std::memory_order_relaxed);
+    buffer.read = 2;
+}
+
+// Writer: slot to fill before Publish
+template <typename T>
+inline T& WriteBuffer(TripleBuffer<T>& buffer)
+{
+    return buffer.slots[buffer.write];
+}
+
+// Writer: hand the filled slot to the reader, take the middle one in exchange
+template <typename T>
+inline void Publish(TripleBuffer<T>& buffer)
+{
+    buffer.write = buffer.middle.exchange(buffer.write | TRIPLE_BUFFER_FRESH, std::memory_order_acq_rel) & TRIPLE_BUFFER_INDEX;
+}
+
+// Reader: newest published value, the same one again if nothing new was published
+// NOTE: Stays valid until the next ReadLatest
+template <typename T>
+inline const T& ReadLatest(TripleBuffer<T>& buffer)
+{
+    if (buffer.middle.load(std::memory_order_relaxed) & TRIPLE_BUFFER_FRESH)
+        buffer.read = buffer.middle.exchange(buffer.read, std::memory_order_acq_rel) & TRIPLE_BUFFER_INDEX;
+
+    return buffer.slots[buffer.read];
+}
@@ -0,0 +1,236 @@
+#pragma once
+#include "Math.h"
+
+// Opt-in lazy vector expressions. Wrapping operands with Lazy() makes the operators
+// build a small expression tree instead of returning a Vector2/Vector3 per step; the
+// whole tree is then evaluated component by component in one pass by Assign():
+//
+//     Assign(ballPosition, Lazy(ballPosition) + Lazy(ballDirection) * ballDelta);
+//     Assign(positions, count, Lazy(positions) + Lazy(directions) * Lazy(deltas));
+//
+// Array operands are indexed together, so an array expression compiles to one fused
+// loop. Only component-wise operations are supported, which also makes it safe for
+// the destination to appear in the expression (in-place update).
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Component access by compile-time index
+template <typename V> struct VectorTraits;
+
+template <>
+struct VectorTraits<Vector2> {
+    static const int size = 2;
+    template <int C> static float Get(const Vector2& v) { return C == 0 ? v.x : v.y; }
+    template <int C> static void Set(Vector2& v, float value) { if (C == 0) v.x = value; else v.y = value; }
+};
+
+template <>
+struct VectorTraits<Vector3> {
+    static const int size = 3;
+    template <int C> static float Get(const Vector3& v) { return C == 0 ? v.x : (C == 1 ? v.y : v.z); }
+    template <int C> static void Set(Vector3& v, float value) { if (C == 0) v.x = value; else if (C == 1) v.y = value; else v.z = value; }
+};
+
+// Base of every expression node (CRTP), keeps the operators away from plain vectors
+template <typename E>
+struct VectorExpr {
+    const E& Self() const { return static_cast<const E&>(*this); }
+};
+
+// Single vector (Step 0) or array of vectors (Step 1)
+template <typename V, int Step>
+struct VectorExprLeaf : VectorExpr<VectorExprLeaf<V, Step>> {
+    const V* data;
+
+    explicit VectorExprLeaf(const V* data) : data(data) {}
+    template <int C> float Get(int i) const { return VectorTraits<V>::template Get<C>(data[i * Step]); }
+};
+
+// Single scalar broadcast to every component
+struct ScalarExprLeaf : VectorExpr<ScalarExprLeaf> {
+    float value;
+
+    explicit ScalarExprLeaf(float value) : value(value) {}
+    template <int C> float Get(int) const { return value; }
+};
+
+// Array of scalars, element i broadcast to every component of index i
+struct ScalarArrayExprLeaf : VectorExpr<ScalarArrayExprLeaf> {
+    const float* data;
+
+    explicit ScalarArrayExprLeaf(const float* data) : data(data) {}
+    template <int C> float Get(int i) const { return data[i]; }
+};
+
+// Component-wise binary operation
+template <typename L, typename R, typename Op>
+struct BinaryExpr : VectorExpr<BinaryExpr<L, R, Op>> {
+    L left;
+    R right;
+
+    BinaryExpr(const L& left, const R& right) : left(left), right(right) {}
+    template <int C> float Get(int i) const { return Op::Apply(left.template Get<C>(i), right.template Get<C>(i)); }
+};
+
+// Component-wise negation
+template <typename E>
+struct NegateExpr : VectorExpr<NegateExpr<E>> {
+    E operand;
+
+    explicit NegateExpr(const E& operand) : operand(operand) {}
+    template <int C> float Get(int i) const { return -operand.template Get<C>(i); }
+};
+
+struct AddOp { static float Apply(float a, float b) { return a + b; } };
+struct SubtractOp { static float Apply(float a, float b) { return a - b; } };
+struct MultiplyOp { static float Apply(float a, float b) { return a * b; } };
+struct DivideOp { static float Apply(float a, float b) { return a / b; } };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Expression leaves
+//----------------------------------------------------------------------------------
+
+// Lazy reference to a single vector (must outlive the expression)
+template <typename V>
+inline VectorExprLeaf<V, 0> Lazy(const V& v)
+{
+    return VectorExprLeaf<V, 0>(&v);
+}
+
+// Lazy reference to an array of vectors, indexed by the Assign() loop
+template <typename V>
+inline VectorExprLeaf<V, 1> Lazy(const V* v)
+{
+    return VectorExprLeaf<V, 1>(v);
+}
+
+template <typename V>
+inline VectorExprLeaf<V, 1> Lazy(V* v)
+{
+    return VectorExprLeaf<V, 1>(v);
+}
+
+// Lazy scalar, broadcast to every component
+inline ScalarExprLeaf Lazy(float value)
+{
+    return ScalarExprLeaf(value);
+}
+
+// Lazy reference to an array of scalars, indexed by the Assign() loop
+inline ScalarArrayExprLeaf Lazy(const float* values)
+{
+    return ScalarArrayExprLeaf(values);
+}
+
+inline ScalarArrayExprLeaf Lazy(float* values)
+{
+    return ScalarArrayExprLeaf(values);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Evaluation
+//----------------------------------------------------------------------------------
+
+template <typename V, int C>
+struct AssignComponents {
+    template <typename E>
+    static void Apply(V& dst, const E& e, int i)
+    {
+        AssignComponents<V, C - 1>::Apply(dst, e, i);
+        VectorTraits<V>::template Set<C - 1>(dst, e.template Get<C - 1>(i));
+    }
+};
+
+template <typename V>
+struct AssignComponents<V, 0> {
+    template <typename E>
+    static void Apply(V&, const E&, int) {}
+};
+
+// Evaluate expression into a single vector
+template <typename V, typename E>
+inline void Assign(V& dst, const VectorExpr<E>& e)
+{
+    V result = dst;
+    AssignComponents<V, VectorTraits<V>::size>::Apply(result, e.Self(), 0);
+    dst = result;
+}
+
+// Evaluate expression for every index in [0, count), one fused loop
+template <typename V, typename E>
+inline void Assign(V* dst, int count, const VectorExpr<E>& e)
+{
+    const E& expr = e.Self();
+    for (int i = 0; i < count; i++)
+    {
+        // Read every operand before the store so aliasing with dst can't force reloads
+        V result = dst[i];
+        AssignComponents<V, VectorTraits<V>::size>::Apply(result, expr, i);
+        dst[i] = result;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Expression operators
+//----------------------------------------------------------------------------------
+
+template <typename L, typename R>
+inline BinaryExpr<L, R, AddOp> operator+(const VectorExpr<L>& a, const VectorExpr<R>& b)
+{
+    return BinaryExpr<L, R, AddOp>(a.Self(), b.Self());
+}
+
+template <typename L, typename R>
+inline BinaryExpr<L, R, SubtractOp> operator-(const VectorExpr<L>& a, const VectorExpr<R>& b)
+{
+    return BinaryExpr<L, R, SubtractOp>(a.Self(), b.Self());
+}
+
+template <typename L, typename R>
+inline BinaryExpr<L, R, MultiplyOp> operator*(const VectorExpr<L>& a, const VectorExpr<R>& b)
+{
+    return BinaryExpr<L, R, MultiplyOp>(a.Self(), b.Self());
+}
+
+template <typename L, typename R>
+inline BinaryExpr<L, R, DivideOp> operator/(const VectorExpr<L>& a, const VectorExpr<R>& b)
+{
+    return BinaryExpr<L, R, DivideOp>(a.Self(), b.Self());
+}
+
+template <typename L>
+inline BinaryExpr<L, ScalarExprLeaf, AddOp> operator+(const VectorExpr<L>& a, float b)
+{
+    return BinaryExpr<L, ScalarExprLeaf, AddOp>(a.Self(), ScalarExprLeaf(b));
+}
+
+template <typename L>
+inline BinaryExpr<L, ScalarExprLeaf, SubtractOp> operator-(const VectorExpr<L>& a, float b)
+{
+    return BinaryExpr<L, ScalarExprLeaf, SubtractOp>(a.Self(), ScalarExprLeaf(b));
+}
+
+template <typename L>
+inline BinaryExpr<L, ScalarExprLeaf, MultiplyOp> operator*(const VectorExpr<L>& a, float b)
+{
+    return BinaryExpr<L, ScalarExprLeaf, MultiplyOp>(a.Self(), ScalarExprLeaf(b));
+}
+
+template <typename R>
+inline BinaryExpr<ScalarExprLeaf, R, MultiplyOp> operator*(float a, const VectorExpr<R>& b)
+{
+    return BinaryExpr<ScalarExprLeaf, R, MultiplyOp>(ScalarExprLeaf(a), b.Self());
+}
+
+template <typename L>
+inline BinaryExpr<L, ScalarExprLeaf, DivideOp> operator/(const VectorExpr<L>& a, float b)
+{
+    return BinaryExpr<L, ScalarExprLeaf, DivideOp>(a.Self(), ScalarExprLeaf(b));
+}
+
+template <typename E>
+inline NegateExpr<E> operator-(const VectorExpr<E>& a)
+{
+    return NegateExpr<E>(a.Self());
+}
@@ -0,0 +1,210 @@
+#pragma once
+#include "raylib.h"
+#include "MappedWave.h"
+#include <chrono>
+#include <cstdio>
+
+// Polyphonic playback of the sound effects. Each sound gets a fixed set of voices, aliases
+// made with LoadSoundAlias that share the sound's samples but play independently, so a hit
+// that comes while the last one is still ringing starts on a free voice instead of cutting
+// it off. With every voice of a sound busy, the one started longest ago is restarted.
+// Voices are created by AddVoiceSound; PlayVoice only picks one and calls PlaySound, it
+// never allocates. Counters: trigger latency (time spent in PlayVoice) and utilization
+// (voices playing, sampled once per frame by TickVoicePool).
+// Sounds added with AddVoiceStream play from a mapped wave instead: each voice is an audio
+// stream of two small buffers that FeedVoicePool refills from the mapping, no copy of the
+// sound is ever loaded. Feeding happens once per frame (TickVoicePool); frames longer than
+// a buffer (VOICE_STREAM_FRAMES) leave a gap in the sound.
+// NOTE: Needs the audio device, an empty pool (headless) ignores PlayVoice.
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+constexpr int VOICE_POOL_SOUNDS = 4;
+constexpr int VOICE_POOL_VOICES = 8;        // Per sound at most
+constexpr int VOICE_STREAM_FRAMES = 2048;   // Per stream buffer: 46 ms at 44.1 kHz, almost 3 frames at 60 FPS and well above the device period
+
+typedef struct VoiceSound {
+    Sound voices[VOICE_POOL_VOICES];        // Aliases of one loaded sound, or
+    AudioStream streams[VOICE_POOL_VOICES]; // streams fed from wave
+    unsigned int cursors[VOICE_POOL_VOICES];    // Next frame of wave each stream is fed
+    MappedWave wave;                        // Streamed sounds only, data is nullptr otherwise
+    unsigned int started[VOICE_POOL_VOICES];    // Trigger number each voice last started on
+    int voiceCount;
+} VoiceSound;
+
+typedef struct VoicePool {
+    VoiceSound sounds[VOICE_POOL_SOUNDS];
+    int soundCount;
+    int voiceCount;                         // All sounds
+
+    // Counters
+    unsigned int triggers;
+    unsigned int steals;                    // Triggers that restarted a busy voice
+    double triggerUs;                       // Time in PlayVoice, total and worst
+    double triggerMaxUs;
+    long long playingSum;                   // Voices playing, summed over ticks
+    int playingPeak;
+    int ticks;
+} VoicePool;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Give sound voiceCount voices at volume, returns its id for PlayVoice (-1 when the pool is full or the sound empty)
+// NOTE: The sound must outlive the pool, aliases don't own the samples
+inline int AddVoiceSound(VoicePool& pool, Sound sound, int voiceCount, float volume)
+{
+    if (pool.soundCount == VOICE_POOL_SOUNDS || sound.stream.buffer == nullptr) return -1;    // Full, or the sound failed to load
+    if (voiceCount > VOICE_POOL_VOICES) voiceCount = VOICE_POOL_VOICES;
+
+    VoiceSound& entry = pool.sounds[pool.soundCount];
+    entry = {};
+    for (int i = 0; i < voiceCount; i++)
+    {
+        entry.voices[i] = LoadSoundAlias(sound);
+        SetSoundVolume(entry.voices[i], volume);
+    }
+    entry.voiceCount = voiceCount;
+    pool.voiceCount += voiceCount;
+
+    return pool.soundCount++;
+}
+
+// Same for a mapped wave, played by streams that read it in place (-1 when the pool is full, the wave empty or there is no audio device)
+// NOTE: The wave must stay mapped while the pool uses it
+inline int AddVoiceStream(VoicePool& pool, MappedWave wave, int voiceCount, float volume)
+{
+    if (pool.soundCount == VOICE_POOL_SOUNDS || wave.data == nullptr || !IsAudioDeviceReady()) return -1;
+    if (voiceCount > VOICE_POOL_VOICES) voiceCount = VOICE_POOL_VOICES;
+
+    VoiceSound& entry = pool.sounds[pool.soundCount];
+    entry = {};
+    SetAudioStreamBufferSizeDefault(VOICE_STREAM_FRAMES);
+    for (int i = 0; i < voiceCount; i++)
+    {
+        entry.streams[i] = LoadAudioStream(wave.sampleRate, wave.sampleSize, wave.channels);
+        SetAudioStreamVolume(entry.streams[i], volume);
+    }
+    SetAudioStreamBufferSizeDefault(0);     // Back to raylib's own choice for other streams
+    entry.wave = wave;
+    entry.voiceCount = voiceCount;
+    pool.voiceCount += voiceCount;
+
+    return pool.soundCount++;
+}
+
+inline void UnloadVoicePool(VoicePool& pool)
+{
+    for (int s = 0; s < pool.soundCount; s++)
+    {
+        for (int i = 0; i < pool.sounds[s].voiceCount; i++)
+        {
+            if (pool.sounds[s].wave.data != nullptr) UnloadAudioStream(pool.sounds[s].streams[i]);
+            else UnloadSoundAlias(pool.sounds[s].voices[i]);
+        }
+    }
+    pool = {};
+}
+
+inline bool IsVoicePlaying(const VoiceSound& entry, int voice)
+{
+    return (entry.wave.data != nullptr) ? IsAudioStreamPlaying(entry.streams[voice]) : IsSoundPlaying(entry.voices[voice]);
+}
+
+// Next buffer of a streamed voice, silence once past the end of the wave
+inline void FeedVoiceStream(VoiceSound& entry, int voice)
+{
+    const MappedWave& wave = entry.wave;
+    unsigned int cursor = entry.cursors[voice];
+    unsigned int frames = (cursor < wave.frameCount) ? wave.frameCount - cursor : 0;
+    if (frames > VOICE_STREAM_FRAMES) frames = VOICE_STREAM_FRAMES;
+
+    const unsigned char* samples = (const unsigned char*)wave.data + (frames > 0 ? (size_t)cursor * wave.channels * (wave.sampleSize / 8) : 0);
+    UpdateAudioStream(entry.streams[voice], samples, (int)frames);   // Straight from the mapping into the mixer's buffer, padded with silence
+    entry.cursors[voice] = cursor + VOICE_STREAM_FRAMES;
+}
+
+// Refill the buffers streamed voices have played, stop the ones whose last samples are out
+// NOTE: Called by TickVoicePool, call it directly while frames aren't ticking (waiting on a sound)
+inline void FeedVoicePool(VoicePool& pool)
+{
+    for (int s = 0; s < pool.soundCount; s++)
+    {
+        VoiceSound& entry = pool.sounds[s];
+        if (entry.wave.data == nullptr) continue;
+
+        for (int i = 0; i < entry.voiceCount; i++)
+        {
+            while (IsAudioStreamPlaying(entry.streams[i]) && IsAudioStreamProcessed(entry.streams[i]))
+            {
+                // A buffer of silence follows the last samples, once that one is due they have played
+                if (entry.cursors[i] >= entry.wave.frameCount + VOICE_STREAM_FRAMES) StopAudioStream(entry.streams[i]);
+                else FeedVoiceStream(entry, i);
+            }
+        }
+    }
+}
+
+// Play sound on a free voice, or restart its oldest one
+inline void PlayVoice(VoicePool& pool, int sound)
+{
+    if (sound < 0 || sound >= pool.soundCount) return;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    VoiceSound& entry = pool.sounds[sound];
+    pool.triggers++;
+
+    int voice = -1;
+    int oldest = 0;
+    for (int i = 0; i < entry.voiceCount && voice < 0; i++)
+    {
+        if (!IsVoicePlaying(entry, i)) voice = i;
+        else if (entry.started[i] < entry.started[oldest]) oldest = i;
+    }
+    if (voice < 0)
+    {
+        voice = oldest;
+        pool.steals++;
+    }
+
+    if (entry.wave.data != nullptr)
+    {
+        StopAudioStream(entry.streams[voice]);  // Both buffers free, filled from the start before it plays
+        entry.cursors[voice] = 0;
+        FeedVoiceStream(entry, voice);
+        FeedVoiceStream(entry, voice);
+        PlayAudioStream(entry.streams[voice]);
+    }
+    else PlaySound(entry.voices[voice]);        // Restarts a playing voice from the beginning
+    entry.started[voice] = pool.triggers;
+
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    pool.triggerUs += us;
+    if (us > pool.triggerMaxUs) pool.triggerMaxUs = us;
+}
+
+// Feed streamed voices and sample how many voices are playing, once per frame
+inline void TickVoicePool(VoicePool& pool)
+{
+    FeedVoicePool(pool);
+
+    int playing = 0;
+    for (int s = 0; s < pool.soundCount; s++)
+        for (int i = 0; i < pool.sounds[s].voiceCount; i++) playing += IsVoicePlaying(pool.sounds[s], i);
+
+    pool.playingSum += playing;
+    if (playing > pool.playingPeak) pool.playingPeak = playing;
+    pool.ticks++;
+}
+
+inline void PrintVoicePool(const VoicePool& pool)
+{
+    if (pool.voiceCount == 0) return;
+
+    double mean = (pool.ticks > 0) ? (double)pool.playingSum / pool.ticks : 0.0;
+    printf("voices: %u triggers, %u stolen, %.2f us mean trigger (%.2f us worst)\n", pool.triggers, pool.steals,
+        (pool.triggers > 0) ? pool.triggerUs / pool.triggers : 0.0, pool.triggerMaxUs);
+    printf("  %.2f of %d voices playing on average (%.1f%%), %d at peak\n", mean, pool.voiceCount, 100.0 * mean / pool.voiceCount, pool.playingPeak);
+}
@@ -1,205 +1,607 @@
 #include "raylib.h"
 #include "Math.h"
+#include "AssetLoader.h"
+#include "Bench.h"
+#include "Capture.h"
+#include "Export.h"
+#include "FramePacer.h"
+#include "GameRender.h"
+#include "MappedWave.h"
+#include "Particles.h"
+#include "RenderList.h"
+#include "Replay.h"
+#include "ScreenReadback.h"
+#include "SoftRender.h"
+#include "SpectatorWall.h"
+#include "TermRender.h"
+#include "VoicePool.h"
+#include "Game.h"
+#include "Jitter.h"
+#include "TripleBuffer.h"
+#include <atomic>
 #include <thread>   // Included after looking for a way to hold.
+#include <cstring>
+#include <chrono>
 
-constexpr float SCREEN_WIDTH = 1200.0f;
-constexpr float SCREEN_HEIGHT = 800.0f;
-constexpr Vector2 CENTER{ SCREEN_WIDTH * 0.5f, SCREEN_HEIGHT * 0.5f };
+// Software rendering (--software): frames go to this CPU framebuffer, no window, GPU or audio
+SoftCanvas softCanvas = {};
+const char* softwareOutput = nullptr;   // Last frame is saved here on exit
+double softwareRenderMs = 0.0;
+DirtyRenderer softwareDirty = {};       // Repaints only what changed, unless --full-redraw
 
-// Ball can move half the screen width per-second
-constexpr float BALL_SPEED = SCREEN_WIDTH * 0.5f;
-constexpr float BALL_SIZE = 40.0f;
+// Null rendering (--null): frames are recorded and dropped, which times the game logic alone
+NullRenderer nullRenderer = {};
+bool nullRendering = false;
+double nullLogicMs = 0.0;               // Step, record and submit
 
-// Paddles can move half the screen height per-second
-constexpr float PADDLE_SPEED = SCREEN_HEIGHT * 0.5f;
-constexpr float PADDLE_WIDTH = 40.0f;
-constexpr float PADDLE_HEIGHT = 80.0f;
+int headlessFrames = 0;                 // Software or null frames done
 
-struct Box
+bool UseSoftware()
 {
-    float xMin;
-    float xMax;
-    float yMin;
-    float yMax;
+    return softCanvas.pixels != nullptr;
+}
+
+bool Headless()
+{
+    return UseSoftware() || nullRendering;
+}
+
+// Frames are recorded into frameList, then drawn by renderer (raylib, software or null)
+RenderList frameList = {};
+RenderBackend renderer = {};
+RaylibRenderer raylibRenderer = {};
+
+// Frame capture (--capture frame_%05d.png or --capture match.y4m)
+FrameCapture* capture = nullptr;
+uint32_t* softwarePixels = nullptr;     // Canvas' own pixels, while frames are drawn into capture buffers
+Color* captureTarget = nullptr;         // Capture buffer holding the current software frame
+ScreenReadback* screenReadback = nullptr;   // OpenGL frames on their way to the capture
+
+// Also called before the window closes, the frames still being read need the GL context
+void ExitCapture()
+{
+    if (screenReadback != nullptr && IsWindowReady())
+    {
+        CaptureScreenReadback(capture, screenReadback, true);
+        UnloadScreenReadback(screenReadback);
+    }
+    screenReadback = nullptr;
+    StopCapture(capture);
+    capture = nullptr;
+}
+
+void ExitSoftware()
+{
+    printf("software: %d frames, %.3f ms render per frame\n", headlessFrames, softwareRenderMs / (headlessFrames > 0 ? headlessFrames : 1));
+    if (softwareDirty.frames > 0)
+    {
+        double pixels = (double)softwareDirty.pixels / softwareDirty.frames;
+        printf("dirty: %.0f pixels touched per frame (%.2f%% of the screen), %d of %d frames redrawn in full\n", pixels,
+            100.0 * pixels / (softCanvas.width * softCanvas.height), softwareDirty.fullFrames, softwareDirty.frames);
+    }
+    if (softwareOutput != nullptr) ExportSoftCanvas(softCanvas, softwareOutput);
+
+    if (captureTarget != nullptr) SubmitCaptureFrame(capture, captureTarget);
+    softCanvas.pixels = softwarePixels;
+    UnloadSoftCanvas(softCanvas);
+}
+
+void ExitNull()
+{
+    printf("null: %d frames, %.3f us game logic per frame, %.1f commands per frame\n", headlessFrames,
+        1000.0 * nullLogicMs / (headlessFrames > 0 ? headlessFrames : 1), (double)nullRenderer.commands / (nullRenderer.frames > 0 ? nullRenderer.frames : 1));
+}
+
+// Queue the finished frame for the encoder thread
+void CaptureScreen()
+{
+    // Software frames are drawn straight into a capture buffer (see BeginFrame), nothing to copy; null frames have no pixels
+    if (Headless())
+        return;
+
+    EndScissorMode();   // Flushes raylib's batch so the read sees every draw
+    if (GetRenderWidth() != (int)SCREEN_WIDTH || GetRenderHeight() != (int)SCREEN_HEIGHT)     // High-DPI scaled window, frames of another size
+        SkipCaptureFrame(capture);
+    else if (screenReadback != nullptr)
+        CaptureScreenReadback(capture, screenReadback, false);  // Read asynchronously, copied into the pool two frames later.
+    else
+    {
+        Image screen = LoadImageFromScreen();   // No pixel buffer objects: waits for the GPU and allocates, over the 0.5 ms budget.
+        if (screen.width == (int)SCREEN_WIDTH && screen.height == (int)SCREEN_HEIGHT) CaptureFrame(capture, (const Color*)screen.data);
+        else SkipCaptureFrame(capture);
+        UnloadImage(screen);
+    }
+}
+
+// Frames go to OpenGL, the software canvas or nowhere
+std::chrono::steady_clock::time_point frameStart;
+
+void BeginFrame()
+{
+    if (UseSoftware())
+    {
+        frameStart = std::chrono::steady_clock::now();
+
+        // Previous frame is complete, queue it and draw this one into a fresh buffer
+        if (capture != nullptr)
+        {
+            if (captureTarget != nullptr) SubmitCaptureFrame(capture, captureTarget);
+            captureTarget = AcquireCaptureFrame(capture);
+            softCanvas.pixels = (captureTarget != nullptr) ? (uint32_t*)captureTarget : softwarePixels;
+        }
+    }
+    else if (!nullRendering) BeginDrawing();
+}
+
+void EndFrame()
+{
+    if (capture != nullptr) CaptureScreen();
+
+    if (UseSoftware()) softwareRenderMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+    if (Headless()) headlessFrames++;
+    else EndDrawing();
+}
+
+void SubmitFrame(const RenderList& list)
+{
+    PrepareRenderList(renderer, list);
+    BeginFrame();
+    DrawRenderList(renderer, list);
+    EndFrame();
+}
+
+// Simulation thread: steps the game at a fixed rate, publishing a snapshot every tick.
+// The main thread polls input, plays sounds and draws the newest snapshot.
+constexpr int SIM_RATE = 120;                                   // Ticks per second, independent of the frame rate.
+constexpr float SIM_DT = 1.0f / SIM_RATE;
+
+// Snapshot with the input sample it was stepped with
+struct SimFrame
+{
+    GameState state;
+    unsigned int input;                 // FramePacer input number
+};
+
+struct GameSim
+{
+    TripleBuffer<SimFrame> snapshots;
+    std::atomic<unsigned int> keys;     // Input number << 4 | GameKey flags held, written by the main thread
+    std::atomic<bool> running;
+    bool autoPlay;                      // Computer players instead of keys (--server)
+    JitterStats jitter;                 // Sim thread only until joined
+    std::thread thread;
 };
 
-bool BoxOverlap(Box box1, Box box2)
+GameSim sim;
+
+// Terminal view (--terminal): a thread of its own draws the newest state to stdout at a
+// low rate. Whoever steps the game publishes a copy for it and never waits on it.
+constexpr int TERMINAL_RATE = 30;
+
+struct TerminalView
+{
+    TripleBuffer<GameState> states;
+    std::atomic<bool> attached;         // States are published only while set
+    std::atomic<bool> running;
+    TerminalRenderer renderer;
+    std::thread thread;
+};
+
+TerminalView terminal;
+
+void PublishTerminal(const GameState& state)
+{
+    if (!terminal.attached.load(std::memory_order_relaxed)) return;
+
+    WriteBuffer(terminal.states) = state;
+    Publish(terminal.states);
+}
+
+void RunTerminal()
+{
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / TERMINAL_RATE));
+
+    RenderList list = {};
+    RenderBackend backend = TerminalBackend(&terminal.renderer);
+    Clock::time_point next = Clock::now();
+
+    for (bool last = false; !last; )
+    {
+        last = !terminal.running.load(std::memory_order_relaxed);      // One more frame after detaching, to show the final state
+        RecordGame(ReadLatest(terminal.states), nullptr, list);
+        DrawRenderList(backend, list);
+
+        next += period;
+        if (Clock::now() > next) next = Clock::now();
+        if (!last) std::this_thread::sleep_until(next);
+    }
+}
+
+void AttachTerminal(const GameState& initial)
+{
+    InitTripleBuffer(terminal.states, initial);
+    terminal.renderer = LoadTerminalRenderer(120, 40, SCREEN_WIDTH / 120, stdout);  // One terminal pixel per 10x10 screen pixels.
+    terminal.running.store(true);
+    terminal.attached.store(true);
+    terminal.thread = std::thread(RunTerminal);
+}
+
+void DetachTerminal()
+{
+    if (!terminal.thread.joinable()) return;
+
+    terminal.running.store(false);
+    terminal.thread.join();
+    terminal.attached.store(false);
+
+    int frames = terminal.renderer.frames > 0 ? terminal.renderer.frames : 1;
+    double cells = (double)terminal.renderer.cellsSent / frames;
+    double bytes = (double)terminal.renderer.bytesSent / frames;
+    UnloadTerminalRenderer(terminal.renderer);
+    printf("terminal: %d frames, %.1f cells and %.0f bytes sent per frame\n", frames, cells, bytes);
+}
+
+// Match recording (--record match.rpl): whoever steps the game records the keys of every tick,
+// the replay is saved on exit and can be turned into a video with --export
+constexpr int REPLAY_MAX_SECONDS = 60 * 60;
+constexpr int REPLAY_KEYFRAME_SECONDS = 2;
+
+Replay recording = {};
+const char* recordingFile = nullptr;
+
+JitterStats renderJitter = LoadJitter("render", 1000.0 / 60.0);
+FramePacer pacer = {};                  // Frame rate and input timing of the main thread
+
+void RunSim()
 {
-    bool x = box1.xMax >= box2.xMin && box1.xMin <= box2.xMax;
-    bool y = box1.yMax >= box2.yMin && box1.yMin <= box2.yMax;
-    return x && y;
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(SIM_DT));
+
+    SimFrame frame = WriteBuffer(sim.snapshots);    // Every slot starts with the initial state
+    Clock::time_point next = Clock::now();
+
+    while (sim.running.load(std::memory_order_relaxed) && frame.state.winner == 0)
+    {
+        TickJitter(sim.jitter);
+        unsigned int keys = sim.autoPlay ? AutoKeys(frame.state) : sim.keys.load(std::memory_order_relaxed);
+        if (recordingFile != nullptr) RecordReplayTick(recording, frame.state, keys & 15);
+        StepGame(frame.state, keys & 15, SIM_DT);
+        frame.input = keys >> 4;
+        WriteBuffer(sim.snapshots) = frame;
+        Publish(sim.snapshots);
+        PublishTerminal(frame.state);
+
+        // Fixed schedule, late ticks catch up; after a long stall (debugger, dragged window) restart from now
+        next += period;
+        Clock::time_point now = Clock::now();
+        if (now - next > period * 8) next = now;
+        std::this_thread::sleep_until(next);
+    }
 }
 
-Rectangle BoxToRec(Box box)
+void StartSim(const GameState& initial)
 {
-    Rectangle rec;
-    rec.x = box.xMin;
-    rec.y = box.yMin;
-    rec.width = box.xMax - box.xMin;
-    rec.height = box.yMax - box.yMin;
-    return rec;
+    InitTripleBuffer(sim.snapshots, SimFrame{ initial, 0 });
+    sim.keys.store(0);
+    sim.running.store(true);
+    sim.jitter = LoadJitter("sim", 1000.0 / SIM_RATE);
+    sim.thread = std::thread(RunSim);
 }
 
-Box BallBox(Vector2 position)
+void StopSim()
 {
-    Box box;
-    box.xMin = position.x - BALL_SIZE * 0.5f;
-    box.xMax = position.x + BALL_SIZE * 0.5f;
-    box.yMin = position.y - BALL_SIZE * 0.5f;
-    box.yMax = position.y + BALL_SIZE * 0.5f;
-    return box;
+    if (!sim.thread.joinable()) return;
+
+    sim.running.store(false);
+    sim.thread.join();
+    DetachTerminal();
+    PrintJitter(sim.jitter);
+    PrintJitter(renderJitter);
+    PrintFramePacer(pacer);
 }
 
-Box PaddleBox(Vector2 position)
+// Sim thread records until joined, save after it is
+void ExitRecording()
 {
-    Box box;
-    box.xMin = position.x - PADDLE_WIDTH * 0.5f;
-    box.xMax = position.x + PADDLE_WIDTH * 0.5f;
-    box.yMin = position.y - PADDLE_HEIGHT * 0.5f;
-    box.yMax = position.y + PADDLE_HEIGHT * 0.5f;
-    return box;
+    StopSim();
+    if (SaveReplay(recording, recordingFile))
+        printf("replay: %d ticks (%.1f s) saved to %s\n", recording.tickCount, (double)recording.tickCount / recording.tickRate, recordingFile);
+    else printf("replay: can't write %s\n", recordingFile);
+    UnloadReplay(recording);
 }
 
-void ResetBall(Vector2& position, Vector2& direction)
+unsigned int PollGameKeys()
 {
-    position = CENTER;
-    direction.x = rand() % 2 == 0 ? -1.0f : 1.0f;
-    direction.y = 0.0f;
-    direction = Rotate(direction, Random(0.0f, 60.0f) * DEG2RAD);   // [Secondary Choice Feature] Changed float 360 to 60.
-}                                                                   // We dont need another random direction flip.
-                                                                    // Fixes bug were ball has no X-axis movement.
-void DrawBall(Vector2 position, Color color)
-{
-    Box ballBox = BallBox(position);
-    DrawRectangleRec(BoxToRec(ballBox), color);
+    unsigned int keys = 0;
+    if (IsKeyDown(KEY_W)) keys |= GAME_KEY_PLAYER1_UP;
+    if (IsKeyDown(KEY_S)) keys |= GAME_KEY_PLAYER1_DOWN;
+    if (IsKeyDown(KEY_E)) keys |= GAME_KEY_PLAYER2_UP;
+    if (IsKeyDown(KEY_D)) keys |= GAME_KEY_PLAYER2_DOWN;
+    return keys;
+}
+
+// Sound effects, a few voices each so quick repeats overlap instead of cutting each other off.
+// The files are decoded on a loader thread while the window and audio device start; a sound
+// joins the pool once decoded, a trigger only waits for its own sound. With --mapped-sounds the
+// files are mapped and streamed from the mapping instead, nothing to decode. The pool stays
+// empty when headless, triggers then play nothing.
+enum SoundEffect
+{
+    SOUND_HIT = 0,                      // sfx1
+    SOUND_WIN,                          // sfx2
+    SOUND_POINT,                        // sfx3
+    SOUND_COUNT
+};
+
+const char* const SOUND_FILES[SOUND_COUNT] = { "ping_pong_8bit_beeep.wav", "ping_pong_8bit_peeeeeep.wav", "ping_pong_8bit_plop.wav" };
+const int SOUND_VOICES[SOUND_COUNT] = { 4, 1, 2 };
+
+AssetLoader* assets = nullptr;
+Sound sounds[SOUND_COUNT] = {};         // Sources of the voices, never played themselves.
+bool soundLoaded[SOUND_COUNT] = {};
+int soundVoices[SOUND_COUNT] = { -1, -1, -1 };
+VoicePool voices = {};
+MappedWave mappedSounds[SOUND_COUNT] = {};     // --mapped-sounds only
+
+std::chrono::steady_clock::time_point launch = std::chrono::steady_clock::now();
+
+void ExitAudio()
+{
+    StopAssetLoader(assets);
+    assets = nullptr;
+    PrintVoicePool(voices);
+}
+
+// Decoded sounds join the pool (needs the audio device); waits only for needed, -1 for none
+void LoadSounds(int needed)
+{
+    if (assets == nullptr) return;
+
+    int loaded = 0;
+    for (int i = 0; i < SOUND_COUNT; i++)
+    {
+        if (!soundLoaded[i] && (i == needed || WaveReady(assets, i)))
+        {
+            Wave wave = TakeWave(assets, i);
+            sounds[i] = LoadSoundFromWave(wave);
+            UnloadWave(wave);
+            soundVoices[i] = AddVoiceSound(voices, sounds[i], SOUND_VOICES[i], 0.1f);  // Set volume to 10% of source value.
+            soundLoaded[i] = true;
+        }
+        loaded += soundLoaded[i];
+    }
+
+    if (loaded == SOUND_COUNT)
+    {
+        double ms = 0.0;
+        for (int i = 0; i < SOUND_COUNT; i++) ms = fmax(ms, WaveReadyMs(assets, i));
+        printf("startup: sounds decoded %.1f ms after the loader started, ready %.1f ms after launch\n", ms,
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - launch).count());
+        StopAssetLoader(assets);
+        assets = nullptr;
+    }
+}
+
+void PlaySoundEffect(SoundEffect sound)
+{
+    LoadSounds(sound);
+    PlayVoice(voices, soundVoices[sound]);
+}
+
+// Effects (main thread only, like sounds): a trail behind the ball, sparks on paddle hits and a
+// burst where the ball left on points. Particles are never part of the game state.
+constexpr int PARTICLE_CAPACITY = 8192;
+constexpr int TRAIL_PARTICLES = 6;                              // Per frame
+
+ParticlePool particles = {};
+
+void EmitEffects(const GameState& state, Vector2 lastBall, bool hit, bool point)
+{
+    if (state.winner == 0)
+    {
+        ParticleBurst trail = { TRAIL_PARTICLES, state.ballPosition, {}, 0.0f, 30.0f, 0.2f, 0.4f, 6.0f, WHITE };
+        EmitParticles(particles, trail);
+    }
+    if (hit)
+    {
+        Vector2 velocity = state.ballDirection * (BALL_SPEED * 0.25f);  // Sparks follow the ball off the paddle.
+        ParticleBurst sparks = { 160, state.ballPosition, velocity, 100.0f, 400.0f, 0.3f, 0.7f, 4.0f, SKYBLUE };
+        EmitParticles(particles, sparks);
+    }
+    if (point)
+    {
+        Vector2 edge = { lastBall.x < CENTER.x ? 0.0f : SCREEN_WIDTH, lastBall.y };    // Ball is back in the center by now.
+        ParticleBurst burst = { 400, edge, {}, 50.0f, 600.0f, 0.5f, 1.2f, 5.0f, ORANGE };
+        EmitParticles(particles, burst);
+    }
 }
 
-void DrawPaddle(Vector2 position, Color color)
-{
-    Box paddleBox = PaddleBox(position);
-    DrawRectangleRec(BoxToRec(paddleBox), color);
-}
-
-int main()
-{
-    Vector2 ballPosition;
-    Vector2 ballDirection;
-    ResetBall(ballPosition, ballDirection);
-
-    Vector2 paddle1Position, paddle2Position;
-    paddle1Position.x = SCREEN_WIDTH * 0.05f;
-    paddle2Position.x = SCREEN_WIDTH * 0.95f;
-    paddle1Position.y = paddle2Position.y = CENTER.y;
-
-    static int player1Points = 0;   // Local variable for player 1 points.
-    static int player2Points = 0;   // Local variable for player 2 points.
-
-    static int volley = 0;      // [Main Choice Feature] Variable for holding volleys between players.
-    bool showVolley = false;    // [Main Choice Feature] Sets bool for volley count.
-
-    InitAudioDevice();                                      // Creates audio device.
-    Sound sfx1 = LoadSound("ping_pong_8bit_beeep.wav");     // cache sound file to be played later.
-    Sound sfx2 = LoadSound("ping_pong_8bit_peeeeeep.wav");  
-    Sound sfx3 = LoadSound("ping_pong_8bit_plop.wav");      
-    SetSoundVolume(sfx1, 0.1f);                             // Set volume to 10% of source value.
-    SetSoundVolume(sfx2, 0.1f);                             
-    SetSoundVolume(sfx3, 0.1f);                             
-
-    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Pong");
-    SetTargetFPS(60);
-    while (!WindowShouldClose())
-    {
-        float dt = GetFrameTime();
-        float ballDelta = BALL_SPEED * dt;
-        float paddleDelta = PADDLE_SPEED * dt;
-
-        // Move paddle with key input
-        if (IsKeyDown(KEY_W))
-            paddle1Position.y -= paddleDelta;
-        if (IsKeyDown(KEY_S))
-            paddle1Position.y += paddleDelta;
-        if (IsKeyDown(KEY_E))                   // [Secondary Choice Feature] Second player controls.
-            paddle2Position.y -= paddleDelta;   // Because its much more fun with TWO players.
-        if (IsKeyDown(KEY_D))
-            paddle2Position.y += paddleDelta;
-
-        // Mirror paddle 1 for now
-        // paddle2Position.y = paddle1Position.y;   // [Secondary Choice Feature] Replaced for second player controls
-
-        float phh = PADDLE_HEIGHT * 0.5f;
-        paddle1Position.y = Clamp(paddle1Position.y, phh, SCREEN_HEIGHT - phh);
-        paddle2Position.y = Clamp(paddle2Position.y, phh, SCREEN_HEIGHT - phh);
-
-        // Change the ball's direction on-collision
-        Vector2 ballPositionNext = ballPosition + ballDirection * ballDelta;
-        Box ballBox = BallBox(ballPositionNext);
-        Box paddle1Box = PaddleBox(paddle1Position);
-        Box paddle2Box = PaddleBox(paddle2Position);
-
-        if (ballBox.xMin < 0.0f || ballBox.xMax > SCREEN_WIDTH)
-            ballDirection.x *= -1.0f,                
-            ResetBall(ballPosition, ballDirection);     // Calls the ball reset function using local Vectors.
-
-        if (ResetBall && ballBox.xMax > SCREEN_WIDTH)               // If ball is on the right when ball resets...
-            PlaySound(sfx3),                                        // Play low sfx.
-            player1Points += 1,                                     // 1 point to player 1.
-            volley = 0,                                             // [Main Choice Feature] Resets volley count to 0.
-            paddle1Position.y = CENTER.y,                           // Paddle 1 resets position.
-            paddle2Position.y = CENTER.y;                           // Paddle 2 resets position.
-
-        if (ResetBall && ballBox.xMin < 0.0f)                       // If ball is on the left when ball resets...
-            PlaySound(sfx3),                                        // Play low sfx.
-            player2Points += 1,                                     // 1 point to player 2.
-            volley = 0,                                             // [Main Choice Feature] Resets volley count to 0.
-            paddle1Position.y = CENTER.y,                           // Paddle 1 resets position.
-            paddle2Position.y = CENTER.y;                           // Paddle 2 resets position.
-
-        if (player1Points == 5)                                     // If player 1 reaches 5 points...
-            DrawText("Player One Wins!", 175, 250, 100, LIME),      // End game text center screen.
-            player1Points = 0,                                      // Reset player 1 points to 0. (not neccessary when function also exits the program)
-            player2Points = 0,                                      // Reset player 2 points to 0. (not neccessary when function also exits the program)
-            PlaySound(sfx2),                                        // Play long beep sfx.
-            EndDrawing(),                                           // Used to wait 1 tick so text can be drawn.
-            std::this_thread::sleep_for(std::chrono::seconds(3)),   // Holds code for 3 seconds. 
-            exit(0);                                                // Exits game.
-
-        if (player2Points == 5)                                     // If player 1 reaches 5 points...
-            DrawText("Player Two Wins!", 175, 250, 100, RED),       // End game text center screen.
-            player1Points = 0,                                      // Reset player 1 points to 0.
-            player2Points = 0,                                      // Reset player 2 points to 0.
-            PlaySound(sfx2),                                        // Play long beep sfx.
-            EndDrawing(),                                           // Used to wait 1 tick so text can be drawn.
-            std::this_thread::sleep_for(std::chrono::seconds(3)),   // Holds code for 3 seconds.
-            exit(0);                                                // Exits game.
-
-        if (ballBox.yMin < 0.0f || ballBox.yMax > SCREEN_HEIGHT)
-            ballDirection.y *= -1.0f;
-        if (BoxOverlap(ballBox, paddle1Box) || BoxOverlap(ballBox, paddle2Box))
-            volley++,
-            PlaySound(sfx1),                                                            // Play Sfx when ball hits paddle.
-            ballDirection.x *= -1.0f;
-
-        if (volley == 5 || volley == 10)                                                // [Main Choice Feature] When volley count is 5 or 10...
-            showVolley = true;                                                          // [Main Choice Feature] Set show volley count to true.
-
-        if (showVolley == true)                                                         // [Main Choice Feature] If volley count set to true...
-            DrawText(TextFormat("%i Volleys!", volley), 500, 200, 50, SKYBLUE);         // [Main Choice Feature] Show text for number of volleys.
-
-        if (volley >= 5 || volley <= 5 || volley >= 10 || volley <= 10)                 // [Main Choice Feature] If volley count is less then or greater then 5 or 10...
-            showVolley = false;                                                         // [Main Choice Feature] Set show volley count to false.
-
-        // Update ball position after collision resolution, then render
-        ballPosition = ballPosition + ballDirection * ballDelta;
-
-        BeginDrawing();
-        ClearBackground(BLACK);
-        DrawText(TextFormat("Player One: %i", player1Points), 20, 10, 20, GRAY);        // Draw score text for player 1 per tick.
-        DrawText(TextFormat("Player Two: %i", player2Points), 1050, 10, 20, GRAY);      // Draw score text for player 2 per tick.
-        DrawBall(ballPosition, WHITE);
-        DrawPaddle(paddle1Position, WHITE);
-        DrawPaddle(paddle2Position, WHITE);
-        EndDrawing();
+int main(int argc, char** argv)
+{
+    if (argc > 2 && strcmp(argv[1], "--bench") == 0)   // Command line benchmarks, no window or audio.
+        return RunBench(argv[2]);
+
+    if (argc > 3 && strcmp(argv[1], "--export") == 0)  // Replay to video on every core: --export match.rpl match.y4m [threads]
+        return RunExport(argv[2], argv[3], argc > 4 ? atoi(argv[4]) : 0);
+
+    if (argc > 2 && strcmp(argv[1], "--wall") == 0)    // Spectator wall of <matches> computer-played matches: --wall 256 [frames [out.png]]
+        return RunSpectatorWall(atoi(argv[2]), argc > 3 ? atoi(argv[3]) : 0, argc > 4 ? argv[4] : nullptr);
+
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--capture") == 0)  // Record every frame in the background, dropping frames if the encoder falls behind.
+        {
+            capture = StartCapture(argv[i + 1], GetCaptureFormat(argv[i + 1]), (int)SCREEN_WIDTH, (int)SCREEN_HEIGHT, 60, 8);
+            if (capture == nullptr) return 1;   // Unusable path, already reported.
+            atexit(ExitCapture);                // Also runs when a win exits the game (after ExitSoftware).
+        }
     }
+
+    if (argc > 2 && strcmp(argv[1], "--software") == 0)  // Render <frames> frames on the CPU, optionally save the last: --software 600 out.png
+    {
+        softCanvas = LoadSoftCanvas((int)SCREEN_WIDTH, (int)SCREEN_HEIGHT);
+        softwarePixels = softCanvas.pixels;
+        softwareOutput = argc > 3 && argv[3][0] != '-' ? argv[3] : nullptr;
+        atexit(ExitSoftware);   // Also runs when a win exits the game.
+        softwareDirty.canvas = &softCanvas;
+        softwareDirty.fullRatio = 0.5f;
+        renderer = SoftwareDirtyBackend(&softwareDirty);
+        for (int i = 3; i < argc; i++)
+            if (strcmp(argv[i], "--full-redraw") == 0) renderer = SoftwareBackend(&softCanvas);  // Repaint every pixel every frame.
+    }
+
+    if (argc > 2 && strcmp(argv[1], "--null") == 0)   // Run <frames> frames without drawing anything: --null 600
+    {
+        nullRendering = true;
+        atexit(ExitNull);
+        renderer = NullBackend(&nullRenderer);
+    }
+    int frameLimit = Headless() ? atoi(argv[2]) : 0;
+
+    GameState state = InitGame(1);  // Ball, paddles, points and volleys.
+    unsigned int hitSounds = 0;     // Sound triggers already played.
+    unsigned int pointSounds = 0;
+    unsigned int input = 0;         // Input sample the drawn state was stepped with.
+    Vector2 lastBall = state.ballPosition;
+    particles = LoadParticlePool(PARTICLE_CAPACITY, 0.1f, 1);      // Keeps 10% of its speed after a second.
+    std::chrono::steady_clock::time_point lastFrame = std::chrono::steady_clock::now();
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)  // Save the keys of every tick to a replay file on exit.
+        {
+            int tickRate = Headless() ? 60 : SIM_RATE;
+            recording = LoadReplayRecorder(tickRate, tickRate * REPLAY_KEYFRAME_SECONDS, tickRate * REPLAY_MAX_SECONDS);
+            recordingFile = argv[i + 1];
+            atexit(ExitRecording);
+        }
+        if (strcmp(argv[i], "--terminal") == 0)     // Also draw the match in this terminal, from a thread of its own.
+        {
+            SetTraceLogLevel(LOG_WARNING);          // Keeps raylib's startup log out of the view.
+            AttachTerminal(state);
+            atexit(DetachTerminal);                 // Before a win exits the game, the thread must be joined.
+        }
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--server") == 0)  // Computer players at the sim rate, no window or audio: --server [--terminal]
+    {
+        sim.autoPlay = true;
+        StartSim(state);
+        while (ReadLatest(sim.snapshots).state.winner == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        state = ReadLatest(sim.snapshots).state;
+        StopSim();
+        printf("server: player %s wins %i - %i after %u ticks\n", state.winner == 1 ? "one" : "two", state.player1Points, state.player2Points, state.tick);
+        return 0;
+    }
+
+    if (!Headless())
+    {
+        bool mapped = false;
+        for (int i = 1; i < argc; i++) mapped |= strcmp(argv[i], "--mapped-sounds") == 0;   // Stream sounds from the mapped files, no loading.
+        if (!mapped) assets = StartAssetLoader(SOUND_FILES, SOUND_COUNT);     // cache sound files to be played later, decoded in the background.
+        atexit(ExitAudio);
+        InitAudioDevice();                                      // Creates audio device.
+        for (int i = 0; i < SOUND_COUNT && mapped; i++)
+        {
+            mappedSounds[i] = MapWave(SOUND_FILES[i]);
+            soundVoices[i] = AddVoiceStream(voices, mappedSounds[i], SOUND_VOICES[i], 0.1f);   // Set volume to 10% of source value.
+            soundLoaded[i] = true;
+        }
+
+        InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Pong");
+        if (capture != nullptr)
+        {
+            screenReadback = LoadScreenReadback((int)SCREEN_WIDTH, (int)SCREEN_HEIGHT);
+            if (screenReadback == nullptr) printf("capture: no pixel buffer objects, reading the screen synchronously\n");
+        }
+        bool uncapped = argc > 1 && strcmp(argv[1], "--uncapped") == 0;   // Draw as fast as possible, for benchmarks.
+        pacer = LoadFramePacer(uncapped ? 0 : 60, 2.0);             // Replaces SetTargetFPS(60): sleep, then spin the last 2 ms.
+
+        raylibRenderer = LoadRaylibRenderer(64 + PARTICLE_CAPACITY);   // Ball, paddles and particles in one call, text cached until it changes.
+        renderer = RaylibBackend(&raylibRenderer);
+        StartSim(state);                                        // Game runs on its own thread from here on.
+    }
+
+    while (Headless() ? headlessFrames < frameLimit : !WindowShouldClose())
+    {
+        std::chrono::steady_clock::time_point logicStart = std::chrono::steady_clock::now();
+
+        if (Headless())
+        {
+            if (recordingFile != nullptr) RecordReplayTick(recording, state, 0);
+            StepGame(state, 0, 1.0f / 60.0f);                   // Headless frames step a fixed 60 FPS on this thread, no input.
+            PublishTerminal(state);
+        }
+        else
+        {
+            WaitNextFrame(pacer);
+            PollInputEvents();                                  // Sample keys as late as possible, right before the frame is drawn.
+            sim.keys.store(MarkInput(pacer) << 4 | PollGameKeys(), std::memory_order_relaxed);
+            const SimFrame& frame = ReadLatest(sim.snapshots);  // Newest tick, frames in between sim ticks show the same one.
+            state = frame.state;
+            input = frame.input;
+        }
+
+        LoadSounds(-1);                                         // Whatever finished decoding, without waiting.
+        for (unsigned int i = hitSounds; i != state.hitSounds; i++)        // Play Sfx when ball hits paddle.
+            PlaySoundEffect(SOUND_HIT);
+        for (unsigned int i = pointSounds; i != state.pointSounds; i++)    // Play low sfx when a point is scored.
+            PlaySoundEffect(SOUND_POINT);
+        TickVoicePool(voices);
+
+        // Particles age by the frame time, fixed when headless so software frames stay reproducible
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        float frameTime = Headless() ? 1.0f / 60.0f : std::chrono::duration<float>(now - lastFrame).count();
+        lastFrame = now;
+        UpdateParticles(particles, frameTime);
+        EmitEffects(state, lastBall, state.hitSounds != hitSounds, state.pointSounds != pointSounds);
+        hitSounds = state.hitSounds;
+        pointSounds = state.pointSounds;
+        lastBall = state.ballPosition;
+
+        RecordGame(state, &particles, frameList);
+        SubmitFrame(frameList);
+        if (!Headless())
+        {
+            MarkPresent(pacer, input);
+            if (pacer.inputCount == 1)
+            {
+                int loaded = 0;
+                for (int i = 0; i < SOUND_COUNT; i++) loaded += soundLoaded[i];
+                printf("startup: first frame %.1f ms after launch, %d of %d sounds loaded by then\n",
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - launch).count(), loaded, SOUND_COUNT);
+            }
+        }
+        TickJitter(renderJitter);
+        if (nullRendering) nullLogicMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - logicStart).count();
+
+        if (state.winner != 0)                                  // If a player reaches 5 points...
+        {
+            PlaySoundEffect(SOUND_WIN);                         // Play long beep sfx.
+            StopSim();
+            for (int i = 0; i < 300; i++)                       // Holds code for 3 seconds.
+            {
+                FeedVoicePool(voices);                          // Streamed sounds still need their buffers refilled.
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            exit(0);                                            // Exits game.
+        }
+    }
+
+    if (Headless())
+        return 0;
+
+    StopSim();
+    UnloadRaylibRenderer(raylibRenderer);
+    UnloadParticlePool(particles);
+    PrintVoicePool(voices);
+    UnloadVoicePool(voices);
+    for (MappedWave& wave : mappedSounds) UnmapWave(wave);
+    ExitCapture();
     CloseWindow();
     return 0;
 }